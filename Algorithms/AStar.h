@@ -8,9 +8,12 @@
 #include <tuple>
 #include <fstream>
 #include <ctime>
+#include <chrono>
+#include <sstream>
 
 #include <unordered_map>
 #include <unordered_set>
+#include <limits>
 
 #include "../PersistenceIO.h"
 #include "../Algorithms/DijkstraShortestPath.h"
@@ -19,6 +22,148 @@
 #include "../Globals.h"
 #include "../External/Mem_usage.h"
 #include "../PriorityQueue.h"
+#include "../ThreadPool.h"
+
+
+/********************************************************************
+* The budget of the optimal cycle search of one homology class, given by
+* Globals::max_expanded_nodes, Globals::max_search_memory and Globals::max_search_time.
+* One budget is shared by all the searches of a class (e.g., the attempts in growing
+* search windows): the searches call exhausted() once per expanded node, and it returns the
+* name of the exhausted budget, or nullptr if the search may go on. It also keeps the
+* largest memory estimate it was given.
+********************************************************************/
+struct searchBudget
+{
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	long long numExpanded = 0; // the number of nodes expanded by all searches so far
+
+	std::size_t peakMemory = 0; // the largest memory estimate of the searches so far, in bytes
+
+	const char * exhausted(std::size_t memoryBytes)
+	{
+		++numExpanded;
+		peakMemory = std::max(peakMemory, memoryBytes);
+		if (Globals::max_expanded_nodes > 0 && numExpanded > Globals::max_expanded_nodes)
+			return "node";
+		if (Globals::max_search_memory > 0 && (memoryBytes >> 20) >= (std::size_t)Globals::max_search_memory)
+			return "memory";
+		if (Globals::max_search_time > 0 && (numExpanded & 1023) == 0) // reading the clock is not free
+		{
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+			if (elapsed.count() >= Globals::max_search_time)
+				return "time";
+		}
+		return nullptr;
+	}
+};
+
+
+/********************************************************************
+* Description:	Compute the search window of a homology class, i.e., the vertices inside the
+						bounding box of its reduced cycle, enlarged by halo in every direction. The
+						reduced cycle lies inside the window, but it may fall apart into several loops.
+						The searches look for a single loop through the pivot edge, and joining the
+						loops can need vertices outside the window, so the window may hold no
+						representative the searches can find.
+* Parameters:
+* - vList:						a list storing the coordinates of vertices
+* - cell2v_list:				a converter which projects cells to their corresponding constituent vertices
+* - inputCycle:				the input homology class
+* - halo:						the margin around the bounding box
+* - resWindowMask:			the result mask, 1 for the vertices inside the window
+* Return:			whether the window covers all vertices (and is therefore useless)
+********************************************************************/
+template<int vertexDim, typename VertexListT>
+bool computeSearchWindow(const VertexListT & vList, const vector<MatrixListType> & cell2v_list,
+	const MatrixListType & inputCycle, int halo, vector<char> & resWindowMask)
+{
+	blitz::TinyVector<int, vertexDim> lower = vList[cell2v_list[inputCycle[0]][0]];
+	blitz::TinyVector<int, vertexDim> upper = lower;
+	for (const auto & edgeIdx : inputCycle)
+	{
+		for (const auto & v : cell2v_list[edgeIdx])
+		{
+			for (int d = 0; d < vertexDim; d++)
+			{
+				lower[d] = std::min(lower[d], vList[v][d]);
+				upper[d] = std::max(upper[d], vList[v][d]);
+			}
+		}
+	}
+
+	resWindowMask.assign(vList.size(), 0);
+	size_t numInside = 0;
+	for (size_t v = 0; v < vList.size(); v++)
+	{
+		bool isInside = true;
+		for (int d = 0; d < vertexDim && isInside; d++)
+			isInside = vList[v][d] >= lower[d] - halo && vList[v][d] <= upper[d] + halo;
+
+		resWindowMask[v] = isInside;
+		numInside += isInside;
+	}
+	return numInside == vList.size();
+}
+
+
+/********************************************************************
+* Description:	Run an optimal cycle search inside a search window, which starts with the given
+						halo around the reduced cycle and is doubled as long as the search finds no
+						representative inside it (see computeSearchWindow). Once the window covers all
+						the vertices, the whole space is searched. A halo of 0 searches the whole space.
+* Parameters:
+* - vList, cell2v_list, inputCycle, halo:	see computeSearchWindow
+* - resShortestCycle:		the result of the search
+* - resPeakMemory:			the estimated peak memory of the searches in bytes
+* - log:						the stream receiving the search statistics
+* - search:					the search, called as search(windowMask, budget) with nullptr for the whole space;
+									it fills resShortestCycle and returns whether the result is optimal.
+									All the attempts share the budget of the class.
+* Return:			the Globals::CycleStatus of the result
+********************************************************************/
+template<int vertexDim, typename VertexListT, typename SearchFunction>
+int searchInWindow(const VertexListT & vList, const vector<MatrixListType> & cell2v_list,
+	const MatrixListType & inputCycle, int halo, const MatrixListType & resShortestCycle, std::size_t & resPeakMemory,
+	std::ostream & log, SearchFunction search)
+{
+	searchBudget budget;
+	vector<char> windowMask;
+	bool isWindowed = halo > 0 && !computeSearchWindow<vertexDim>(vList, cell2v_list, inputCycle, halo, windowMask);
+	while (true)
+	{
+		if (isWindowed)
+			log << "Search window: " << halo << " around the reduced cycle" << endl;
+
+		bool isOptimal = search(isWindowed ? &windowMask : nullptr, budget);
+		resPeakMemory = budget.peakMemory;
+		if (!isWindowed)
+			return isOptimal ? Globals::CycleStatus::OPTIMAL : Globals::CycleStatus::BUDGET_EXCEEDED;
+		if (!resShortestCycle.empty())
+			return isOptimal ? Globals::CycleStatus::WINDOW_OPTIMAL : Globals::CycleStatus::BUDGET_EXCEEDED;
+
+		halo *= 2;
+		isWindowed = !computeSearchWindow<vertexDim>(vList, cell2v_list, inputCycle, halo, windowMask);
+	}
+}
+
+
+// the name of a Globals::CycleStatus in the memory footprint files
+const char * cycleStatusName(int status)
+{
+	switch (status)
+	{
+	case Globals::CycleStatus::OPTIMAL:
+		return "Yes";
+	case Globals::CycleStatus::WINDOW_OPTIMAL:
+		return "Inside window";
+	case Globals::CycleStatus::BUDGET_EXCEEDED:
+		return "No";
+	default:
+		return "Not optimized";
+	}
+}
 
 
 /********************************************************************
@@ -26,24 +171,23 @@
 * Parameters:
 * - source:						the source of search
 * - target:						the target of search
-* - previous:					the input backtracing information
+* - nodePool:					the nodes generated by the search, addressed by handles
+* - goal:						the handle of the node reaching the target
 * - edgeMap:					a map, mapping two endpoints to an edge
 * - resShortestCycle:		the result shortest representative cycle
 ********************************************************************/
-void backtraceShortestCycle(int source, int target, const vector<pair<int, int>> & previous,
+void backtraceShortestCycle(int source, int target, const vector<cgNode> & nodePool, int goal,
 	const map<pair<int, int>, int> & edgeMap, MatrixListType & resShortestCycle)
 {
 	resShortestCycle.clear();
 
 	int mappedEdge;
 	int ptr_1, ptr_2;
-	ptr_1 = target;
 
-	int pathSize = previous.size();
-	for (int i = 0; i < pathSize; ++i)
+	for (int curr = goal; nodePool[curr].parent != -1; curr = nodePool[curr].parent) // walk back along the parent handles
 	{
-		ptr_1 = previous[i].first;
-		ptr_2 = previous[i].second;
+		ptr_1 = nodePool[curr].vertex;
+		ptr_2 = nodePool[nodePool[curr].parent].vertex;
 		if (ptr_1 > ptr_2)
 			mappedEdge = edgeMap.at(std::make_pair(ptr_2, ptr_1));
 		else
@@ -68,7 +212,10 @@ void backtraceShortestCycle(int source, int target, const vector<pair<int, int>>
 
 /********************************************************************
 * Description:	Given a homology class, this function employs A* algorithm to compute
-						its shortest representative cycle.
+						its shortest representative cycle. If the search budget is exhausted first,
+						the input cycle is returned instead; if no representative exists inside the
+						search window, the result is empty.
+* Return:			whether the result is proven to be optimal (within the search window)
 * Parameters:
 * - inputCycle:				the input homology class
 * - cell2v_list:				a converter which projects cells to their corresponding constituent vertices
@@ -76,10 +223,15 @@ void backtraceShortestCycle(int source, int target, const vector<pair<int, int>>
 * - edgeMap:					a map, mapping two endpoints to an edge
 * - vertexNum:				the number of vertices in the whole topological space
 * - resShortestCycle:		the result shortest representative cycle
+* - log:						the stream receiving the search statistics
+* - windowMask:				if given, the search is restricted to the vertices inside the window
+* - budget:					if given, the search budget of the class, shared with its other searches;
+									otherwise the search has a budget of its own
 ********************************************************************/
-void AStar_Optimal_Cycle(const MatrixListType & inputCycle, const vector<MatrixListType> & cell2v_list,
+bool AStar_Optimal_Cycle(const MatrixListType & inputCycle, const vector<MatrixListType> & cell2v_list,
 	const map<pair<int, int>, BitSet> & edgeAnnotations, const std::map<std::pair<int, int>, int> & edgeMap,
-	int vertexNum, MatrixListType & resShortestCycle)
+	int vertexNum, MatrixListType & resShortestCycle, std::ostream & log = cout, const vector<char> * windowMask = nullptr,
+	searchBudget * budget = nullptr)
 {
 	resShortestCycle.clear();
 
@@ -107,134 +259,398 @@ void AStar_Optimal_Cycle(const MatrixListType & inputCycle, const vector<MatrixL
 	for (size_t i = 0; i < low; i++)
 	{
 		edge = cell2v_list[i];
+		if (windowMask != nullptr && !((*windowMask)[edge[0]] && (*windowMask)[edge[1]]))
+			continue;
 		graph[edge[0]].push_back(neighbor(edge[1]));
 		graph[edge[1]].push_back(neighbor(edge[0]));
 	}
 
-	// -- Construct covering graphs for computing heuristics
-	vector<adjacency_list_t> coveringGraphs(BettiNum);
-	for (size_t i = 0; i < BettiNum; i++)
-	{
-		constructCoveringGraph1D(edgeAnnotations, cell2v_list, low, i, vertexNum, coveringGraphs[i]);
-	}
+	// -- Precompute the pattern databases (distance tables of covering graphs) for heuristics
+	edgeGraph compactGraph;
+	constructEdgeGraph(cell2v_list, low, vertexNum, compactGraph, windowMask);
+
+	vector<patternDatabase> patternDatabases;
+	computePatternDatabases(edgeAnnotations, cell2v_list, compactGraph, low, target, BettiNum, patternDatabases);
 
 	// -- Perform A* algorithm
-	cgNode currentNode, neighborNode;
+	// All generated nodes live in nodePool and are addressed by 32-bit handles; the open set only
+	// stores handles, and nodeIndex maps a (vertex, annotation) pair to the handle of its node.
+	vector<cgNode> nodePool;
+	unordered_map<pair<int, BitSet>, int, KeyHasher> nodeIndex;
+	unordered_map<pair<int, BitSet>, int, KeyHasher>::const_iterator it_node;
+	priorityQueue searchQ(nodePool); // priority queue for A* algorithm
+
 	cgNode sourceNode(BettiNum);
 	sourceNode.vertex = source;
-
-	priorityQueue searchQ; // priority queue for A* algorithm
-	searchQ.push(sourceNode);
-
-	unordered_map<pair<int, BitSet>, int, KeyHasher> computedHeuristics; // given a vertex, we store its already computed shortest path to the target for future usage
-	unordered_map<pair<int, BitSet>, int, KeyHasher>::const_iterator it_heuristc;
-	unordered_set<pair<int, BitSet>, KeyHasher> hasVisited; // a set which records nodes that have been visited
-	unordered_set<pair<int, BitSet>, KeyHasher>::const_iterator ret;
-
-	vector<unordered_map<int, int>> heuristic_database; // database of dynamically precomputed heuristic
-	for (int i = 0; i < BettiNum; ++i)
-		heuristic_database.push_back(unordered_map<int, int>());
-
-	int cntExpanedNode = 0; // count the number of expaned nodes
-	bool isInOpenSet = false;
+	nodePool.push_back(sourceNode);
+	nodeIndex.insert({ std::make_pair(source, sourceNode.sumAnnotation), 0 });
+	searchQ.push(0);
+
+	long long cntExpanedNode = 0; // count the number of expaned nodes
+	searchBudget ownBudget;
+	if (budget == nullptr)
+		budget = &ownBudget;
+	const char * exhaustedBudget = nullptr;
+	std::size_t bytesPerNode = sizeof(cgNode) + 2 * (std::size_t)((BettiNum + 7) >> 3) // the node, its annotation and its key in nodeIndex
+		+ sizeof(pair<int, BitSet>) + sizeof(int) + 2 * sizeof(void *) + 2 * sizeof(int); // hash entry and heap slots
+	std::size_t bytesDatabases = 0;
+	for (const auto & database : patternDatabases)
+		bytesDatabases += database.distance.size() * sizeof(int);
+	int currHandle, currVertex, nbHandle;
+	double currGScore, gScore;
 	double lenHeuristicPath = 0;
+	BitSet currAnnotation(BettiNum);
 	BitSet uvTargetAnnotation(BettiNum);
-	pair<int, BitSet> keyH(-1, BitSet(BettiNum)); // search key for heuristics in computedHeuristics
-
-	std::size_t physMemUsed; // for monitoring the memory footprint
-	ofstream memoryFile(Globals::memoryFileName_HeuristicAlg, ios::out | ios::app);
-	clock_t currTime;
+	pair<int, BitSet> keyH(-1, BitSet(BettiNum)); // search key for nodes in nodeIndex
 
-	while (true)
+	while (!searchQ.isEmpty())
 	{
-		currentNode = searchQ.top();
+		currHandle = searchQ.top();
 		searchQ.pop();
-		hasVisited.insert(std::make_pair(currentNode.vertex, currentNode.sumAnnotation));
+		nodePool[currHandle].isClosed = true;
 		++cntExpanedNode;
 
-		if (currentNode.vertex == target && currentNode.sumAnnotation == targetAnnotation) // we have reached the target
+		exhaustedBudget = budget->exhausted(bytesDatabases + nodePool.size() * bytesPerNode);
+		if (exhaustedBudget != nullptr)
+			break;
+
+		// copy out what we need, since nodePool may grow (and reallocate) while expanding
+		currVertex = nodePool[currHandle].vertex;
+		currGScore = nodePool[currHandle].gScore;
+		currAnnotation = nodePool[currHandle].sumAnnotation;
+
+		if (currVertex == target && currAnnotation == targetAnnotation) // we have reached the target
 		{
-			backtraceShortestCycle(source, target, currentNode.previous, edgeMap, resShortestCycle); // find the shortest cycle
+			backtraceShortestCycle(source, target, nodePool, currHandle, edgeMap, resShortestCycle); // find the shortest cycle
 			break;
 		}
 
-		const std::vector<neighbor> & neighbors = graph[currentNode.vertex];
+		const std::vector<neighbor> & neighbors = graph[currVertex];
 		for (const auto & nb : neighbors)
 		{
-			neighborNode = cgNode(BettiNum);
-			neighborNode.vertex = nb.target;
-
-
 			// -- update sumAnnotation
-			neighborNode.sumAnnotation = currentNode.sumAnnotation;
+			keyH.first = nb.target;
+			keyH.second = currAnnotation;
 
-			if (currentNode.vertex > nb.target) // still, we need to sort the endpoints
+			if (currVertex > nb.target) // still, we need to sort the endpoints
 			{
 				key.first = nb.target;
-				key.second = currentNode.vertex;
+				key.second = currVertex;
 			}
 			else
 			{
-				key.first = currentNode.vertex;
+				key.first = currVertex;
 				key.second = nb.target;
 			}
 
 			it_annotation = edgeAnnotations.find(key);
 			if (it_annotation != edgeAnnotations.end()) // it is a sentinel edge
-				neighborNode.sumAnnotation ^= it_annotation->second;
-
+				keyH.second ^= it_annotation->second;
 
-			// -- update fScore and gScore
-			keyH.first = neighborNode.vertex;
-			keyH.second = neighborNode.sumAnnotation;
+			gScore = currGScore + nb.weight;
 
-			it_heuristc = computedHeuristics.find(keyH);
-			if (it_heuristc != computedHeuristics.end()) // we have already computed that
+			it_node = nodeIndex.find(keyH);
+			if (it_node == nodeIndex.end()) // a new node, compute its heuristic and insert it into the open set
 			{
-				lenHeuristicPath = it_heuristc->second;
+				uvTargetAnnotation = keyH.second ^ targetAnnotation;
+				lenHeuristicPath = computeHeuristic(patternDatabases, uvTargetAnnotation, nb.target, vertexNum);
+				if (lenHeuristicPath < 0) // this node can never reach the target
+					continue;
+
+				cgNode neighborNode;
+				neighborNode.vertex = nb.target;
+				neighborNode.sumAnnotation = keyH.second;
+				neighborNode.gScore = gScore;
+				neighborNode.fScore = gScore + lenHeuristicPath;
+				neighborNode.parent = currHandle;
+
+				nbHandle = nodePool.size();
+				nodePool.push_back(std::move(neighborNode));
+				nodeIndex.insert({ keyH, nbHandle });
+				searchQ.push(nbHandle);
+				continue;
 			}
-			else
+
+			// -- we have expanded this node before
+			nbHandle = it_node->second;
+			cgNode & neighborNode = nodePool[nbHandle];
+			if (neighborNode.isClosed)
+				continue;
+
+			// -- it is in open set, update it if we found a shorter path
+			if (neighborNode.gScore > gScore)
 			{
-				uvTargetAnnotation = neighborNode.sumAnnotation ^ targetAnnotation;
-				lenHeuristicPath = computeHeuristic(coveringGraphs, uvTargetAnnotation, 
-					neighborNode.vertex, target, BettiNum, vertexNum, heuristic_database);
-				computedHeuristics[keyH] = lenHeuristicPath;
+				lenHeuristicPath = neighborNode.fScore - neighborNode.gScore;
+				neighborNode.gScore = gScore;
+				neighborNode.fScore = gScore + lenHeuristicPath;
+				neighborNode.parent = currHandle;
+				searchQ.decreaseKey(nbHandle);
 			}
-			neighborNode.gScore = currentNode.gScore + nb.weight;
-			neighborNode.fScore = neighborNode.gScore + lenHeuristicPath;
+		}
+	}// end while
 
+	log << "Number of expanded nodes: " << cntExpanedNode << endl;
+	if (exhaustedBudget != nullptr)
+	{
+		log << "Search " << exhaustedBudget << " budget exhausted, keep the reduced cycle (not proven optimal)" << endl;
+		resShortestCycle = inputCycle;
+		return false;
+	}
+	if (resShortestCycle.empty()) // only possible inside a search window
+	{
+		log << "No representative cycle inside the search window" << endl;
+		return false;
+	}
+	return true;
+}
 
-			// -- update previous vector
-			neighborNode.previous = currentNode.previous; // inherits its parent's data
-			neighborNode.previous.push_back(std::make_pair(nb.target, currentNode.vertex));
 
+/********************************************************************
+* Description:	Bidirectional version of AStar_Optimal_Cycle. The lifted (vertex, annotation)
+						graph is undirected and the goal state (target, targetAnnotation) is known, so
+						a second A* search runs backwards from the goal state towards (source, 0). Both
+						searches use pattern database heuristics, which are consistent: the forward one
+						with the databases towards the target, the backward one with the databases
+						towards the source. The side with the smaller open set is expanded next. Every
+						state reached by both searches gives a candidate path; the search stops once the
+						best candidate is not longer than the larger of the two minimal f-scores: a
+						shorter path would have to pass a state whose f-score is below the best length
+						in both searches, and one of them has no such state left. If the budget runs
+						out, the best candidate found so far is returned if it is shorter than the
+						reduced cycle.
+* Return:			whether the result is proven to be optimal (within the search window)
+* Parameters:		the same as AStar_Optimal_Cycle
+********************************************************************/
+bool BidirectionalAStar_Optimal_Cycle(const MatrixListType & inputCycle, const vector<MatrixListType> & cell2v_list,
+	const map<pair<int, int>, BitSet> & edgeAnnotations, const std::map<std::pair<int, int>, int> & edgeMap,
+	int vertexNum, MatrixListType & resShortestCycle, std::ostream & log = cout, const vector<char> * windowMask = nullptr,
+	searchBudget * budget = nullptr)
+{
+	resShortestCycle.clear();
 
-			// -- insert it into priority queue
-			// -- first, check if it is in close set
-			ret = hasVisited.find(make_pair(neighborNode.vertex, neighborNode.sumAnnotation));
-			if (ret != hasVisited.end()) // we have expanded this node before
-				continue;
+	assert(!edgeAnnotations.empty());
+	int BettiNum = (edgeAnnotations.cbegin()->second).getBitSize();
 
-			// -- next, check if it is in open set
-			isInOpenSet = false;
-			isInOpenSet = searchQ.updateNodeInQueue(neighborNode);
-			if (isInOpenSet == false) // this neighbor node is not in open set, so add it
-				searchQ.push(neighborNode);
+	BitSet targetAnnotation(BettiNum); // the target annotation we should reach finally
+	computeCycleAnnotation(inputCycle, cell2v_list, edgeAnnotations, targetAnnotation);
+
+	int low = inputCycle.back();
+	MatrixListType edge, pivot = cell2v_list[low];
+	int source = pivot[0];
+	int target = pivot[1];
+	if (source > target)
+		SWAP(source, target);
+
+	pair<int, int> key(source, target);
+	map<pair<int, int>, BitSet>::const_iterator it_annotation;
+	it_annotation = edgeAnnotations.find(key);
+	if (it_annotation != edgeAnnotations.end()) // the pivot edge is a sentinel edge
+		targetAnnotation ^= it_annotation->second; // exclude the pivot edge
+
+	// -- Construct undirected graph for A*
+	adjacency_list_t graph(vertexNum);
+	for (size_t i = 0; i < low; i++)
+	{
+		edge = cell2v_list[i];
+		if (windowMask != nullptr && !((*windowMask)[edge[0]] && (*windowMask)[edge[1]]))
+			continue;
+		graph[edge[0]].push_back(neighbor(edge[1]));
+		graph[edge[1]].push_back(neighbor(edge[0]));
+	}
+
+	// -- Precompute the pattern databases towards both ends of the search
+	edgeGraph compactGraph;
+	constructEdgeGraph(cell2v_list, low, vertexNum, compactGraph, windowMask);
+
+	vector<patternDatabase> patternDatabases[2]; // [0]: towards the target, for the forward search; [1]: towards the source
+	computePatternDatabases(edgeAnnotations, cell2v_list, compactGraph, low, target, BettiNum, patternDatabases[0]);
+	computePatternDatabases(edgeAnnotations, cell2v_list, compactGraph, low, source, BettiNum, patternDatabases[1]);
+
+	// -- The two searches: [0] forward from (source, 0), [1] backward from (target, targetAnnotation)
+	struct searchDirection
+	{
+		vector<cgNode> nodePool;
+		unordered_map<pair<int, BitSet>, int, KeyHasher> nodeIndex;
+		priorityQueue searchQ;
+		searchDirection() : searchQ(nodePool) {}
+	} directions[2];
+
+	BitSet uvTargetAnnotation(BettiNum);
+	auto heuristic = [&](int dir, int vertex, const BitSet & annotation) {
+		if (dir == 0)
+		{
+			uvTargetAnnotation = annotation;
+			uvTargetAnnotation ^= targetAnnotation;
+			return computeHeuristic(patternDatabases[0], uvTargetAnnotation, vertex, vertexNum);
 		}
-	}// end for
+		return computeHeuristic(patternDatabases[1], annotation, vertex, vertexNum);
+	};
 
-	 // -- monitor the memory footprint
-	physMemUsed = getPeakRSS() >> 20;
-	currTime = clock();
-	memoryFile << "Betti Number: " << BettiNum << "\t " << "Memory Footprint: " << physMemUsed << " (MB)" << endl;
+	for (int dir = 0; dir < 2; dir++)
+	{
+		cgNode startNode(BettiNum);
+		startNode.vertex = (dir == 0) ? source : target;
+		if (dir == 1)
+			startNode.sumAnnotation = targetAnnotation;
+		int lenHeuristicPath = heuristic(dir, startNode.vertex, startNode.sumAnnotation);
+		startNode.fScore = std::max(lenHeuristicPath, 0);
+
+		directions[dir].nodePool.push_back(startNode);
+		directions[dir].nodeIndex.insert({ std::make_pair(startNode.vertex, startNode.sumAnnotation), 0 });
+		directions[dir].searchQ.push(0);
+	}
 
-	cout << "Number of expanded nodes: " << cntExpanedNode << endl;
-	memoryFile.close();
+	long long cntExpanedNode = 0; // count the number of expaned nodes
+	searchBudget ownBudget;
+	if (budget == nullptr)
+		budget = &ownBudget;
+	const char * exhaustedBudget = nullptr;
+	std::size_t bytesPerNode = sizeof(cgNode) + 2 * (std::size_t)((BettiNum + 7) >> 3)
+		+ sizeof(pair<int, BitSet>) + sizeof(int) + 2 * sizeof(void *) + 2 * sizeof(int);
+	std::size_t bytesDatabases = 0;
+	for (const auto & databases : patternDatabases)
+		for (const auto & database : databases)
+			bytesDatabases += database.distance.size() * sizeof(int);
+
+	double bestLength = std::numeric_limits<double>::infinity(); // the shortest path through a state reached from both sides
+	int meetingHandle[2] = { -1, -1 };
+	int currHandle, currVertex, nbHandle;
+	double currGScore, gScore;
+	int lenHeuristicPath;
+	BitSet currAnnotation(BettiNum);
+	pair<int, BitSet> keyH(-1, BitSet(BettiNum)); // search key for nodes in nodeIndex
+	unordered_map<pair<int, BitSet>, int, KeyHasher>::const_iterator it_node;
+
+	while (!directions[0].searchQ.isEmpty() && !directions[1].searchQ.isEmpty())
+	{
+		double minFScore[2];
+		for (int dir = 0; dir < 2; dir++)
+			minFScore[dir] = directions[dir].nodePool[directions[dir].searchQ.top()].fScore;
+		if (bestLength <= std::max(minFScore[0], minFScore[1])) // no shorter path can be found any more
+			break;
+
+		int dir = (directions[0].searchQ.size() <= directions[1].searchQ.size()) ? 0 : 1;
+		searchDirection & curr = directions[dir];
+		const searchDirection & other = directions[1 - dir];
+
+		currHandle = curr.searchQ.top();
+		curr.searchQ.pop();
+		curr.nodePool[currHandle].isClosed = true;
+		++cntExpanedNode;
+
+		exhaustedBudget = budget->exhausted(bytesDatabases + (directions[0].nodePool.size() + directions[1].nodePool.size()) * bytesPerNode);
+		if (exhaustedBudget != nullptr)
+			break;
+
+		// copy out what we need, since nodePool may grow (and reallocate) while expanding
+		currVertex = curr.nodePool[currHandle].vertex;
+		currGScore = curr.nodePool[currHandle].gScore;
+		currAnnotation = curr.nodePool[currHandle].sumAnnotation;
+
+		for (const auto & nb : graph[currVertex])
+		{
+			// -- update sumAnnotation
+			keyH.first = nb.target;
+			keyH.second = currAnnotation;
+
+			key.first = std::min(currVertex, nb.target);
+			key.second = std::max(currVertex, nb.target);
+			it_annotation = edgeAnnotations.find(key);
+			if (it_annotation != edgeAnnotations.end()) // it is a sentinel edge
+				keyH.second ^= it_annotation->second;
+
+			gScore = currGScore + nb.weight;
+
+			it_node = curr.nodeIndex.find(keyH);
+			if (it_node == curr.nodeIndex.end()) // a new node, compute its heuristic and insert it into the open set
+			{
+				lenHeuristicPath = heuristic(dir, nb.target, keyH.second);
+				if (lenHeuristicPath < 0) // this node can never reach the other end
+					continue;
+
+				cgNode neighborNode;
+				neighborNode.vertex = nb.target;
+				neighborNode.sumAnnotation = keyH.second;
+				neighborNode.gScore = gScore;
+				neighborNode.fScore = gScore + lenHeuristicPath;
+				neighborNode.parent = currHandle;
+
+				nbHandle = curr.nodePool.size();
+				curr.nodePool.push_back(std::move(neighborNode));
+				curr.nodeIndex.insert({ keyH, nbHandle });
+				curr.searchQ.push(nbHandle);
+			}
+			else
+			{
+				nbHandle = it_node->second;
+				cgNode & neighborNode = curr.nodePool[nbHandle];
+				if (neighborNode.isClosed || neighborNode.gScore <= gScore)
+					continue;
+
+				// -- it is in open set, update it since we found a shorter path
+				double lenHeuristic = neighborNode.fScore - neighborNode.gScore;
+				neighborNode.gScore = gScore;
+				neighborNode.fScore = gScore + lenHeuristic;
+				neighborNode.parent = currHandle;
+				curr.searchQ.decreaseKey(nbHandle);
+			}
+
+			// -- has the other search reached this state as well?
+			it_node = other.nodeIndex.find(keyH);
+			if (it_node != other.nodeIndex.end() && gScore + other.nodePool[it_node->second].gScore < bestLength)
+			{
+				bestLength = gScore + other.nodePool[it_node->second].gScore;
+				meetingHandle[dir] = nbHandle;
+				meetingHandle[1 - dir] = it_node->second;
+			}
+		}
+	}// end while
+
+	log << "Number of expanded nodes: " << cntExpanedNode << endl;
+	if (exhaustedBudget != nullptr)
+	{
+		// the best path through a meeting state is a representative as well, keep it if it beats the reduced cycle
+		if (meetingHandle[0] == -1 || bestLength + 1 >= inputCycle.size())
+		{
+			log << "Search " << exhaustedBudget << " budget exhausted, keep the reduced cycle (not proven optimal)" << endl;
+			resShortestCycle = inputCycle;
+			return false;
+		}
+		log << "Search " << exhaustedBudget << " budget exhausted, keep the best cycle found (not proven optimal)" << endl;
+	}
+	else if (meetingHandle[0] == -1) // only possible inside a search window
+	{
+		log << "No representative cycle inside the search window" << endl;
+		return false;
+	}
+
+	// -- walk back from the meeting state to both ends
+	for (int dir = 0; dir < 2; dir++)
+	{
+		const vector<cgNode> & nodePool = directions[dir].nodePool;
+		for (int curr = meetingHandle[dir]; nodePool[curr].parent != -1; curr = nodePool[curr].parent)
+		{
+			int ptr_1 = std::min(nodePool[curr].vertex, nodePool[nodePool[curr].parent].vertex);
+			int ptr_2 = std::max(nodePool[curr].vertex, nodePool[nodePool[curr].parent].vertex);
+			resShortestCycle.push_back(edgeMap.at(std::make_pair(ptr_1, ptr_2)));
+		}
+	}
+
+	// add the pivot edge
+	resShortestCycle.push_back(edgeMap.at(std::make_pair(source, target)));
+	mysort(resShortestCycle);
+	return exhaustedBudget == nullptr;
 }
 
 
 /********************************************************************
 * Description:	Interface for running A star algorithm.
+*					The homology classes are independent of each other, so they are processed
+*					in parallel on the shared thread pool, the most expensive ones (estimated by
+*					the number of edges below their pivots) first. The logs and results of each
+*					class are buffered and written out in column order afterwards, so the output
+*					does not depend on the number of threads.
+*					Globals::BIDIRECTIONAL_ALG selects the bidirectional search.
 * Parameters:
 * - phi:							the input filter function
 * - vList							a list storing the coordinates of vertices
@@ -246,20 +662,23 @@ void AStar_Optimal_Cycle(const MatrixListType & inputCycle, const vector<MatrixL
 * - cell2v_list:				a converter which projects cells to their corresponding constituent vertices
 * - vertexNum:				the number of vertices in the whole topological space
 * - low_array:				an array storing the pivot information
+* - cycleStatus:				the result Globals::CycleStatus of each column
+* - windowHalo:				if positive, search inside a window around each reduced cycle (see searchInWindow)
 ********************************************************************/
-template<int arrayDim, int vertexDim = arrayDim>
-void reduceND_AStar(blitz::Array<double, arrayDim> * phi, const vector<blitz::TinyVector<int, vertexDim>> & vList,
+template<int arrayDim, int vertexDim = arrayDim, typename VertexListT>
+void reduceND_AStar(blitz::Array<double, arrayDim> * phi, const VertexListT & vList,
 	const vector<int> & lowerCellList, const vector<CellNrType> & upperCellList, vector<MatrixListType> & boundaryMatrix,
 	const std::map<std::pair<int, int>, int> & edgeMap, const vector<MatrixListType> &cell2v_list, int vertexNum,
-	vector<int> &low_array)
+	vector<int> &low_array, vector<int> & cycleStatus, int windowHalo = 0)
 {
-	cout << "--- Using Heuristic-based Algorithm ---" << endl;
-	ofstream memoryFile(Globals::memoryFileName_HeuristicAlg, ios::out | ios::trunc);
-	memoryFile.close();
-
-	clock_t startClock, endClock;
-
-	std::map<int, MatrixListType> resCycles;
+	bool isBidirectional = (Globals::which_alg == Globals::Algorithm::BIDIRECTIONAL_ALG);
+	if (isBidirectional)
+		cout << "--- Using Heuristic-based Algorithm (Bidirectional) ---" << endl;
+	else
+		cout << "--- Using Heuristic-based Algorithm ---" << endl;
+
+	// -- collect the homology classes to be optimized
+	vector<int> classList;
 	for (int test = 0; test < boundaryMatrix.size(); test++)
 	{
 		if (boundaryMatrix[test].empty())
@@ -267,33 +686,61 @@ void reduceND_AStar(blitz::Array<double, arrayDim> * phi, const vector<blitz::Ti
 
 		double birthTime, deathTime;
 		double pers = computePersistence<arrayDim, vertexDim>(phi, vList, lowerCellList, upperCellList, boundaryMatrix, test, birthTime, deathTime);
-		if (pers <= Globals::reduction_threshold)
-			continue;
+		if (pers > Globals::reduction_threshold)
+			classList.push_back(test);
+	}
+
+	vector<int> schedule;
+	scheduleByCost(boundaryMatrix, classList, schedule);
+
+	vector<MatrixListType> resCycles(classList.size());
+	vector<string> logs(classList.size());
+	vector<int> BettiNums(classList.size());
+	vector<int> statusList(classList.size());
+	vector<std::size_t> physMemUsed(classList.size()); // the estimated peak memory of each search, for monitoring the memory footprint
+
+	getThreadPool().run(schedule.size(), [&](int task, int) {
+		int idx = schedule[task];
+		int test = classList[idx];
+		std::ostringstream log;
 
 		// We first compute the annotations of all edges
-		cout << "---------------------------------------" << endl;
-		cout << "Compute edge annotations ..." << endl;
+		log << "---------------------------------------" << endl;
+		log << "Compute edge annotations ..." << endl;
 		map<pair<int, int>, BitSet> edgeAnnotations;
 		computeAnnotations(boundaryMatrix, edgeMap, low_array, cell2v_list, test, vertexNum, edgeAnnotations);
+		BettiNums[idx] = (edgeAnnotations.cbegin()->second).getBitSize();
+
+		auto startTime = std::chrono::steady_clock::now();
+		std::size_t peakMemory = 0;
+		log << (isBidirectional ? "Apply bidirectional A* algorithm ..." : "Apply A* algorithm ...") << endl;
+		statusList[idx] = searchInWindow<vertexDim>(vList, cell2v_list, boundaryMatrix[test], windowHalo, resCycles[idx], peakMemory, log,
+			[&](const vector<char> * windowMask, searchBudget & budget) {
+			if (isBidirectional)
+				return BidirectionalAStar_Optimal_Cycle(boundaryMatrix[test], cell2v_list, edgeAnnotations, edgeMap, vertexNum, resCycles[idx], log, windowMask, &budget);
+			return AStar_Optimal_Cycle(boundaryMatrix[test], cell2v_list, edgeAnnotations, edgeMap, vertexNum, resCycles[idx], log, windowMask, &budget);
+		});
+		log << "Size before: " << boundaryMatrix[test].size() << endl;
+		log << "Size after: " << resCycles[idx].size() << endl;
+
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+		log << "Time consumed (s): " << elapsed.count() << endl;
+		log << "---------------------------------------" << endl;
+
+		physMemUsed[idx] = peakMemory >> 20;
+		logs[idx] = log.str();
+	});
 
-		startClock = clock();
-		cout << "Apply A* algorithm ..." << endl;
-		MatrixListType resCycle;
-		AStar_Optimal_Cycle(boundaryMatrix[test], cell2v_list, edgeAnnotations, edgeMap, vertexNum, resCycle);
-		cout << "Size before: " << boundaryMatrix[test].size() << endl;
-		cout << "Size after: " << resCycle.size() << endl;
-
-		endClock = clock();
-		cout << "Time consumed (s): " << (float)(endClock - startClock) / CLOCKS_PER_SEC << endl;
-		cout << "---------------------------------------" << endl;
-
-		resCycles.insert({ test, resCycle });
-	}
-	for (const auto & cycle : resCycles)
+	ofstream memoryFile(Globals::memoryFileName_HeuristicAlg, ios::out | ios::trunc);
+	for (size_t idx = 0; idx < classList.size(); idx++)
 	{
-		boundaryMatrix[cycle.first] = cycle.second;
+		cout << logs[idx];
+		memoryFile << "Betti Number: " << BettiNums[idx] << "\t " << "Memory Footprint: " << physMemUsed[idx] << " (MB)"
+			<< "\t " << "Optimal: " << cycleStatusName(statusList[idx]) << endl;
+		boundaryMatrix[classList[idx]] = resCycles[idx];
+		cycleStatus[classList[idx]] = statusList[idx];
 	}
+	memoryFile.close();
 }
 
 #endif // !A_STAR_H
-
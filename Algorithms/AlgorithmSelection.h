@@ -0,0 +1,174 @@
+#ifndef ALGORITHM_SELECTION_H
+#define ALGORITHM_SELECTION_H
+
+#include <iostream>
+#include <map>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <limits>
+#include <cmath>
+
+#include "AnnotatingEdges.h"
+#include "AStar.h"
+#include "ExhaustiveSearch.h"
+#include "../Globals.h"
+#include "../ThreadPool.h"
+#include "../External/Mem_usage.h"
+
+
+/********************************************************************
+* Cost model for choosing between A* and exhaustive search for one homology class.
+* The work of both algorithms is estimated from the Betti number B and the number E of
+* edges below the pivot:
+* - exhaustive search visits up to E * 2^B edges of the covering graph;
+* - A* builds ceil(B/k) pattern databases of E * 2^k edges each (k = Globals::pattern_size),
+*   and then expands about E nodes, each with a heuristic of B/k lookups.
+* The work is converted into seconds with a fixed time per unit of work of each algorithm,
+* measured once on sample inputs, so the choice only depends on the class and not on the
+* timing of the run.
+********************************************************************/
+class cycleCostModel
+{
+public:
+	// the estimated work of applying algorithm alg (a Globals::Algorithm) to a class
+	static double work(int alg, int BettiNum, int numEdges)
+	{
+		if (alg == Globals::Algorithm::CLASSICAL_ALG)
+		{
+			if (BettiNum > 64) // not supported by exhaustive search
+				return std::numeric_limits<double>::infinity();
+			return (double)numEdges * std::ldexp(1.0, BettiNum);
+		}
+
+		int groupSize = std::max(1, std::min(std::min(Globals::pattern_size, BettiNum), 16));
+		int numDatabases = (BettiNum + groupSize - 1) / groupSize;
+		return (double)numEdges * (numDatabases * std::ldexp(1.0, groupSize) + numDatabases);
+	}
+
+	// the estimated time (s) of applying algorithm alg to a class
+	static double estimate(int alg, int BettiNum, int numEdges)
+	{
+		return work(alg, BettiNum, numEdges) * secondsPerWork(alg);
+	}
+
+	// the algorithm with the smaller estimated time
+	static int choose(int BettiNum, int numEdges)
+	{
+		if (estimate(Globals::Algorithm::CLASSICAL_ALG, BettiNum, numEdges) < estimate(Globals::Algorithm::HEURISTIC_BASED_ALG, BettiNum, numEdges))
+			return Globals::Algorithm::CLASSICAL_ALG;
+		return Globals::Algorithm::HEURISTIC_BASED_ALG;
+	}
+
+private:
+	static double secondsPerWork(int alg)
+	{
+		// exhaustive search mostly stops far below its E * 2^B bound, hence the smaller figure
+		return (alg == Globals::Algorithm::CLASSICAL_ALG) ? 1e-8 : 3e-8;
+	}
+};
+
+
+/********************************************************************
+* Description:	Interface for running the automatic choice between A* and exhaustive search.
+*					Each homology class is sent to the algorithm with the smaller estimated time
+*					(see cycleCostModel); the classes are processed in parallel as in reduceND_AStar.
+*					The choice, the estimates and the measured time are logged for tuning the model;
+*					the measured time does not affect the choice, so the output is reproducible.
+* Parameters:		the same as reduceND_AStar
+********************************************************************/
+template<int arrayDim, int vertexDim = arrayDim, typename VertexListT>
+void reduceND_Auto(blitz::Array<double, arrayDim> * phi, const VertexListT & vList,
+	const vector<int> & lowerCellList, const vector<CellNrType> & upperCellList, vector<MatrixListType> & boundaryMatrix,
+	const std::map<std::pair<int, int>, int> & edgeMap, const vector<MatrixListType> &cell2v_list, int vertexNum,
+	vector<int> &low_array, vector<int> & cycleStatus, int windowHalo = 0)
+{
+	cout << "--- Using Automatic Algorithm Selection ---" << endl;
+
+	// -- collect the homology classes to be optimized
+	vector<int> classList;
+	for (int test = 0; test < boundaryMatrix.size(); test++)
+	{
+		if (boundaryMatrix[test].empty())
+			continue;
+
+		double birthTime, deathTime;
+		double pers = computePersistence<arrayDim, vertexDim>(phi, vList, lowerCellList, upperCellList, boundaryMatrix, test, birthTime, deathTime);
+		if (pers > Globals::reduction_threshold)
+			classList.push_back(test);
+	}
+
+	vector<int> schedule;
+	scheduleByCost(boundaryMatrix, classList, schedule);
+
+	vector<MatrixListType> resCycles(classList.size());
+	vector<string> logs(classList.size());
+	vector<int> BettiNums(classList.size());
+	vector<int> statusList(classList.size());
+	vector<int> chosenAlg(classList.size());
+	vector<double> estimatedTime(classList.size());
+	vector<double> actualTime(classList.size());
+	vector<std::size_t> physMemUsed(classList.size()); // the estimated peak memory of each search, for monitoring the memory footprint
+
+	getThreadPool().run(schedule.size(), [&](int task, int) {
+		int idx = schedule[task];
+		int test = classList[idx];
+		int low = boundaryMatrix[test].back();
+		std::ostringstream log;
+
+		// We first compute the annotations of all edges
+		log << "---------------------------------------" << endl;
+		log << "Compute edge annotations ..." << endl;
+		map<pair<int, int>, BitSet> edgeAnnotations;
+		computeAnnotations(boundaryMatrix, edgeMap, low_array, cell2v_list, test, vertexNum, edgeAnnotations);
+		int BettiNum = (edgeAnnotations.cbegin()->second).getBitSize();
+		BettiNums[idx] = BettiNum;
+
+		double estimateExhaustive = cycleCostModel::estimate(Globals::Algorithm::CLASSICAL_ALG, BettiNum, low);
+		double estimateAStar = cycleCostModel::estimate(Globals::Algorithm::HEURISTIC_BASED_ALG, BettiNum, low);
+		chosenAlg[idx] = cycleCostModel::choose(BettiNum, low);
+		estimatedTime[idx] = std::min(estimateExhaustive, estimateAStar);
+		log << "Cost model (Betti number " << BettiNum << ", " << low << " edges): exhaustive search " << estimateExhaustive
+			<< " s, A* " << estimateAStar << " s" << endl;
+
+		auto startTime = std::chrono::steady_clock::now();
+		std::size_t peakMemory = 0;
+		log << (chosenAlg[idx] == Globals::Algorithm::CLASSICAL_ALG ? "Apply Exhaustive Search algorithm ..." : "Apply A* algorithm ...") << endl;
+		statusList[idx] = searchInWindow<vertexDim>(vList, cell2v_list, boundaryMatrix[test], windowHalo, resCycles[idx], peakMemory, log,
+			[&](const vector<char> * windowMask, searchBudget & budget) {
+			if (chosenAlg[idx] == Globals::Algorithm::HEURISTIC_BASED_ALG)
+				return AStar_Optimal_Cycle(boundaryMatrix[test], cell2v_list, edgeAnnotations, edgeMap, vertexNum, resCycles[idx], log, windowMask, &budget);
+
+			edgeGraph graph;
+			constructEdgeGraph(cell2v_list, low, vertexNum, graph, windowMask);
+			return ExhaustiveSearch(graph, boundaryMatrix[test], cell2v_list, edgeAnnotations, vertexNum, edgeMap, resCycles[idx], log, windowMask, &budget);
+		});
+		log << "Size before: " << boundaryMatrix[test].size() << endl;
+		log << "Size after: " << resCycles[idx].size() << endl;
+
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+		actualTime[idx] = elapsed.count();
+		log << "Time consumed (s): " << actualTime[idx] << endl;
+		log << "---------------------------------------" << endl;
+
+		physMemUsed[idx] = peakMemory >> 20;
+		logs[idx] = log.str();
+	});
+
+	ofstream memoryFile(Globals::memoryFileName_AutoAlg, ios::out | ios::trunc);
+	for (size_t idx = 0; idx < classList.size(); idx++)
+	{
+		cout << logs[idx];
+		memoryFile << "Betti Number: " << BettiNums[idx] << "\t " << "Memory Footprint: " << physMemUsed[idx] << " (MB)"
+			<< "\t " << "Optimal: " << cycleStatusName(statusList[idx])
+			<< "\t " << "Algorithm: " << (chosenAlg[idx] == Globals::Algorithm::CLASSICAL_ALG ? "Exhaustive" : "A*")
+			<< "\t " << "Estimated Time: " << estimatedTime[idx] << " (s)"
+			<< "\t " << "Actual Time: " << actualTime[idx] << " (s)" << endl;
+		boundaryMatrix[classList[idx]] = resCycles[idx];
+		cycleStatus[classList[idx]] = statusList[idx];
+	}
+	memoryFile.close();
+}
+
+#endif // !ALGORITHM_SELECTION_H
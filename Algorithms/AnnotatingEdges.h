@@ -9,21 +9,27 @@
 #include <random>
 #include <unordered_map>
 #include <unordered_set>
-#include <thread>
-#include <mutex>
+#include <atomic>
+#include <memory>
+#include <numeric>
 
 #include "../PersistenceIO.h"
 #include "../Algorithms/DijkstraShortestPath.h"
 #include "../STLUtils.h"
 #include "../BitSet.h" // data structure for handling binary annotation
+#include "../DenseBitVector.h"
 #include "../Globals.h"
- 
-std::mutex thread_mutex;
+#include "../ThreadPool.h"
 
 using namespace std;
 
 /********************************************************************
-* Description:	Given a graph, this function computes an arbitrary spanning tree
+* Description:	Given a graph, this function computes a BFS spanning forest. BFS trees are
+						shallow, which keeps the sentinel cycles short. The roots of the trees are
+						taken in a shuffled vertex order, seeded with Globals::spanning_tree_seed.
+						Every level of the BFS is expanded in parallel; a vertex reached from several
+						vertices of the frontier takes the one with the smallest index as its parent,
+						so the forest only depends on the seed, not on the number of threads.
 * Parameters:	
 * - InputGraph:				the input graph
 * - inputGraphEdges:		the edge set of input graph
@@ -33,60 +39,71 @@ using namespace std;
 void computeSpanningTree(const adjacency_list_t & inputGraph, vector<pair<int, int>> & inputGraphEdges,
 	adjacency_list_t & resSpanningTree, vector<pair<int, int>> & resSentinelEdges)
 {
-	std::stack<int> stk; // stack used for DFS
-	size_t numV = inputGraph.size();
+	const int CHUNK_SIZE = 1024; // the number of frontier vertices expanded by one task
+	int numV = inputGraph.size();
 	std::vector<bool> isVisited(numV, false);
-	int currentV, neighborV;
-	int neighborSZ;
-	int i;
-	neighbor nb(0, 0);
+	std::unique_ptr<std::atomic<int>[]> claimedBy(new std::atomic<int>[numV]); // the smallest frontier vertex reaching a vertex
+	for (int i = 0; i < numV; i++)
+		claimedBy[i].store(INT_MAX, std::memory_order_relaxed);
 
 	std::vector<std::pair<int, int>> treeEdges;
 	resSentinelEdges.clear();
 	resSpanningTree.clear();
 	resSpanningTree.resize(numV);
 
-	std::random_device rd;
-	std::mt19937 g(rd());
-	vector<int> order(4);
+	std::mt19937 g(Globals::spanning_tree_seed);
 	vector<int> nodesOrder(numV);
-
 	int temp = { -1 };
 	std::generate(nodesOrder.begin(), nodesOrder.end(), [&temp] {return ++temp;});
 	std::shuffle(nodesOrder.begin(), nodesOrder.end(), g);
 
-	for (int h = 0; h < numV; h++) // DFS
+	vector<int> frontier;
+	vector<vector<int>> discovered; // the vertices first reached by each task of the current level
+	for (int h = 0; h < numV; h++) // BFS
 	{
-		i = nodesOrder[h];
-
-		if (isVisited[i] == true || inputGraph[i].empty())
+		int root = nodesOrder[h];
+		if (isVisited[root] == true || inputGraph[root].empty())
 			continue;
 
-		isVisited[i] = true;
-		stk.push(i);
-
-		while (!stk.empty())
+		isVisited[root] = true;
+		frontier.assign(1, root);
+		while (!frontier.empty())
 		{
-			currentV = stk.top();
-			stk.pop();
-
-			const std::vector<neighbor> & neighbors = inputGraph[currentV];
-			neighborSZ = neighbors.size();
-
-			int n = { -1 };
-			order.resize(neighborSZ);
-			std::generate(order.begin(), order.end(), [&n] {return ++n;});
-			std::shuffle(order.begin(), order.end(), g);
+			int numTasks = (frontier.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+			discovered.assign(numTasks, vector<int>());
+			getThreadPool().run(numTasks, [&](int task, int) {
+				size_t last = std::min(frontier.size(), (size_t)(task + 1) * CHUNK_SIZE);
+				for (size_t k = task * CHUNK_SIZE; k < last; k++)
+				{
+					int currentV = frontier[k];
+					for (const auto & nb : inputGraph[currentV])
+					{
+						int neighborV = nb.target;
+						if (isVisited[neighborV] == true) // only modified between levels
+							continue;
+
+						int claimant = claimedBy[neighborV].load(std::memory_order_relaxed);
+						while (currentV < claimant)
+						{
+							if (claimedBy[neighborV].compare_exchange_weak(claimant, currentV, std::memory_order_relaxed))
+							{
+								if (claimant == INT_MAX) // we are the first to reach it
+									discovered[task].push_back(neighborV);
+								break;
+							}
+						}
+					}
+				}
+			});
 
-			for (int h = 0; h < neighborSZ; ++h) // check all its neighbors
+			frontier.clear();
+			for (const auto & list : discovered)
 			{
-				nb = neighbors[order[h]];
-
-				neighborV = nb.target;
-				if (isVisited[neighborV] == false)
+				for (const auto & neighborV : list)
 				{
+					int currentV = claimedBy[neighborV].load(std::memory_order_relaxed);
 					isVisited[neighborV] = true;
-					stk.push(neighborV);
+					frontier.push_back(neighborV);
 
 					resSpanningTree[currentV].push_back(neighbor(neighborV)); // create a tree edge
 					resSpanningTree[neighborV].push_back(neighbor(currentV));
@@ -98,7 +115,7 @@ void computeSpanningTree(const adjacency_list_t & inputGraph, vector<pair<int, i
 				}
 			}
 		}
-	} // end DFS
+	} // end BFS
 
 	// Next, compute the sentinel edges
 	std::sort(treeEdges.begin(), treeEdges.end());
@@ -111,86 +128,6 @@ void computeSpanningTree(const adjacency_list_t & inputGraph, vector<pair<int, i
 }
 
 
-/********************************************************************
-* Description:	Given a sentinel edge, this function returns its corresponding unique
-						sentinel cycle in the spanning tree. We use BFS to find such a cycle.
-* Parameters:
-* - inputSpanningTree:	the input spanning tree
-* - edge:						the input sentinel edge
-* - edgeMap:					a map, mapping two endpoints to an edge
-* - resSentinelCycle:		the result sentinel cycle corresponding to the input edge
-********************************************************************/
-void computeSentinelCycle(const adjacency_list_t & inputSpanningTree, const pair<int, int> & edge, const map<pair<int, int>, int> & edgeMap,
-	MatrixListType & resSentinelCycle)
-{
-	resSentinelCycle.clear();
-
-	size_t numV = inputSpanningTree.size();
-	std::queue<int> searchQ; // used for BFS
-	std::map<int, int> previous; // used for backtracing the cycle path
-	std::vector<bool> isVisited(numV, false);
-
-	int source = edge.first;
-	int target = edge.second;
-	int neighborV, currentV;
-	bool hasFound = false; // has found the target?
-
-	// begin BFS
-	searchQ.push(source);
-	isVisited[source] = true;
-	previous[source] = target;
-	while (!hasFound)
-	{
-		currentV = searchQ.front();
-		searchQ.pop();
-
-		const std::vector<neighbor> & neighbors = inputSpanningTree[currentV];
-		for (const auto & nb : neighbors)
-		{
-			neighborV = nb.target;
-			if (isVisited[neighborV] == false)
-			{
-				isVisited[neighborV] = true;
-				previous[neighborV] = currentV;
-				searchQ.push(neighborV);
-
-				if (neighborV == target)
-				{
-					hasFound = true;
-					break;
-				}
-			}
-		}
-	} // end while
-
-	// construct the sentinel cycle
-	int ptr_1, ptr_2;
-	int resEdge;
-	currentV = target;
-	do
-	{
-		neighborV = previous[currentV];
-		if (currentV > neighborV) // sort the endpoints into nondecreasing order
-		{
-			ptr_1 = neighborV;
-			ptr_2 = currentV;
-		}
-		else
-		{
-			ptr_1 = currentV;
-			ptr_2 = neighborV;
-		}
-
-		resEdge = edgeMap.at(std::make_pair(ptr_1, ptr_2)); // query the associated edge
-		resSentinelCycle.push_back(resEdge);
-
-		currentV = neighborV;
-	} while (currentV != target);
-
-	mysort(resSentinelCycle);
-}
-
-
 /********************************************************************
 * Description:	Given a persistent homology class, compute the corresponding betti number
 * Parameters:
@@ -235,8 +172,8 @@ int computeBettiNumber(const vector<MatrixListType> & redBoundary, int birth, in
 * - boundaryMatrix:		the reduced boundary matrix
 * - column:					specifies which homology class
 ********************************************************************/
-template<int arrayDim, int vertexDim = arrayDim>
-double computePersistence(blitz::Array<double, arrayDim> * phi, const vector<blitz::TinyVector<int, vertexDim>> &vList,
+template<int arrayDim, int vertexDim = arrayDim, typename VertexListT>
+double computePersistence(blitz::Array<double, arrayDim> * phi, const VertexListT &vList,
 	const vector<int> & lowerCellList, const vector<CellNrType> & upperCellList, 
 	const vector<MatrixListType> & boundaryMatrix, int column, double & birthTime, double & deathTime)
 {
@@ -255,46 +192,197 @@ double computePersistence(blitz::Array<double, arrayDim> * phi, const vector<bli
 
 
 /********************************************************************
-* Description:	thread for computing annotation of a given sentinel edge
+* Description:	Order the homology classes to be optimized by their estimated cost, the most
+						expensive first. The search of a class only visits the edges born before its
+						pivot, so the pivot serves as the estimate; ties keep the column order.
+* Parameters:
+* - boundaryMatrix:		the reduced boundary matrix
+* - classList:				the columns of the homology classes
+* - resSchedule:			the result order, as indices into classList
+********************************************************************/
+void scheduleByCost(const vector<MatrixListType> & boundaryMatrix, const vector<int> & classList, vector<int> & resSchedule)
+{
+	resSchedule.resize(classList.size());
+	for (size_t i = 0; i < classList.size(); i++)
+		resSchedule[i] = i;
+
+	std::stable_sort(resSchedule.begin(), resSchedule.end(), [&](int a, int b) {
+		return boundaryMatrix[classList[a]].back() > boundaryMatrix[classList[b]].back();
+	});
+}
+
+
+/********************************************************************
+* Description:	Root every tree of the spanning forest. The sentinel cycle of an edge (u, v)
+						is then the edge itself plus the tree paths from u and v up to their lowest
+						common ancestor, which can be walked without any search.
+* Parameters:
+* - inputSpanningTree:	the input spanning tree (forest)
+* - edgeMap:					a map, mapping two endpoints to an edge
+* - resTree:					the result parent, parent edge and depth of each vertex
+********************************************************************/
+struct rootedTree
+{
+	vector<int> parent;			// the parent vertex, -1 for roots
+	vector<int> parentEdge;		// the edge connecting a vertex with its parent
+	vector<int> depth;
+};
+
+void computeRootedTree(const adjacency_list_t & inputSpanningTree, const map<pair<int, int>, int> & edgeMap, rootedTree & resTree)
+{
+	size_t numV = inputSpanningTree.size();
+	resTree.parent.assign(numV, -1);
+	resTree.parentEdge.assign(numV, -1);
+	resTree.depth.assign(numV, -1);
+
+	vector<int> searchQ; // used for BFS
+	searchQ.reserve(numV);
+	for (size_t root = 0; root < numV; root++)
+	{
+		if (resTree.depth[root] != -1)
+			continue;
+
+		resTree.depth[root] = 0;
+		searchQ.clear();
+		searchQ.push_back(root);
+		for (size_t head = 0; head < searchQ.size(); head++)
+		{
+			int currentV = searchQ[head];
+			for (const auto & nb : inputSpanningTree[currentV])
+			{
+				int neighborV = nb.target;
+				if (resTree.depth[neighborV] != -1)
+					continue;
+
+				resTree.depth[neighborV] = resTree.depth[currentV] + 1;
+				resTree.parent[neighborV] = currentV;
+				resTree.parentEdge[neighborV] = edgeMap.at(std::make_pair(std::min(currentV, neighborV), std::max(currentV, neighborV)));
+				searchQ.push_back(neighborV);
+			}
+		}
+	}
+}
+
+
+/********************************************************************
+* Description:	Find the essential classes among the edges up to low, i.e., the positive edges
+						which are not the pivot of any reduced boundary column. They occur when the
+						complex is not acyclic in the end, e.g., for a truncated or sparse Rips complex.
+						The essential class of edge p is represented by p plus the path between its
+						endpoints in the forest of the negative edges, whose edges all come before p.
+* Parameters:
+* - cell2v_list:				a converter which projects cells to their corresponding constituent vertices
+* - low_array:				an array storing the pivot information
+* - low:							the last edge to consider
+* - vertexNum:				the number of vertices
+* - edgeMap:					a map, mapping two endpoints to an edge
+* - resForest:				the result rooted forest of the negative edges
+* - resEssentialEdges:		the result essential edges, in increasing order
+********************************************************************/
+void computeEssentialEdges(const vector<MatrixListType> & cell2v_list, const vector<int> & low_array, int low, int vertexNum,
+	const map<pair<int, int>, int> & edgeMap, rootedTree & resForest, vector<int> & resEssentialEdges)
+{
+	resEssentialEdges.clear();
+
+	vector<int> component(vertexNum); // union-find over the vertices, with path halving
+	std::iota(component.begin(), component.end(), 0);
+	auto findRoot = [&component](int v) {
+		while (component[v] != v)
+			v = component[v] = component[component[v]];
+		return v;
+	};
+
+	adjacency_list_t forest(vertexNum);
+	for (int i = 0; i <= low; i++)
+	{
+		const MatrixListType & edge = cell2v_list[i];
+		int root_1 = findRoot(edge[0]), root_2 = findRoot(edge[1]);
+		if (root_1 != root_2) // negative edge, it merges two components
+		{
+			component[root_1] = root_2;
+			forest[edge[0]].push_back(neighbor(edge[1]));
+			forest[edge[1]].push_back(neighbor(edge[0]));
+		}
+		else if (low_array[i] == Globals::BIG_INT) // positive edge whose class never dies
+			resEssentialEdges.push_back(i);
+	}
+
+	if (!resEssentialEdges.empty())
+		computeRootedTree(forest, edgeMap, resForest);
+}
+
+
+/********************************************************************
+* Description:	task for computing the annotations of a range of sentinel edges
+						Each sentinel cycle is written into a reusable dense bit vector and reduced
+						there by xoring in the colored columns, so no memory is allocated per edge.
+						A pivot without a column is an essential edge: its cycle (see
+						computeEssentialEdges) is xored in instead, and its bit is set.
 * Parameters:
 * - sentinelEdges:			the set of sentinel edges
-* - spanningTree:			spanning tree
+* - first, last:				the range [first, last) of sentinelEdges handled by this task
+* - tree:						the rooted spanning tree
+* - numCells:				the number of edges in the graph, i.e., the size of the bit vector
+* - essentialForest:		the forest of the negative edges, for the cycles of the essential edges
+* - essentialBits:			the essential edges, and their bits (following the colored columns)
+* - resAnnotations:			the result annotations, one preallocated slot per sentinel edge
 * - other parameters are self-explanatory
 ********************************************************************/
-void threadComputeAnnotation(const vector<pair<int, int>> & sentinelEdges,
-	const adjacency_list_t & spanningTree, const map<pair<int, int>, int> & edgeMap,
-	const vector<int> & low_array, int death, int bettiNum, const vector<MatrixListType> & redBoundary,
-	const map<int, int> & mapColorColumnIdx, map<pair<int, int>, BitSet> & resEdgeAnnotations)
+void threadComputeAnnotation(const vector<pair<int, int>> & sentinelEdges, int first, int last,
+	const rootedTree & tree, int numCells, const map<pair<int, int>, int> & edgeMap,
+	const vector<int> & low_array, int death, const vector<MatrixListType> & redBoundary, const vector<MatrixListType> & cell2v_list,
+	const map<int, int> & mapColorColumnIdx, const rootedTree & essentialForest, const map<int, int> & essentialBits,
+	vector<BitSet> & resAnnotations)
 {
-	MatrixListType sentinelCycle;
-	BitSet annotation(bettiNum);
-	int low;
+	DenseBitVector sentinelCycle(numCells);
+	int deathColumnIdx = mapColorColumnIdx.at(death);
+	int low, u, v;
 
-	for (const auto & edge : sentinelEdges)
+	for (int i = first; i < last; i++)
 	{
-		annotation.reset(); // reinitialized as zeros
-		sentinelCycle.clear();
-		computeSentinelCycle(spanningTree, edge, edgeMap, sentinelCycle);
+		BitSet & annotation = resAnnotations[i]; // zero-initialized, only this task writes it
+
+		// the sentinel cycle: the sentinel edge plus the tree paths to the common ancestor
+		sentinelCycle.flip(edgeMap.at(sentinelEdges[i]));
+		u = sentinelEdges[i].first;
+		v = sentinelEdges[i].second;
+		while (u != v)
+		{
+			if (tree.depth[u] < tree.depth[v])
+				SWAP(u, v);
+			sentinelCycle.flip(tree.parentEdge[u]);
+			u = tree.parent[u];
+		}
 
 		// performe reduction on this sentinel cycle using all the colored columns, thereby obtaining the annotation.
-		while (!sentinelCycle.empty()) // we continue the reduction until it is empty
+		// We continue the reduction until it is empty, which leaves the bit vector clean for the next edge.
+		while ((low = sentinelCycle.highestBit()) != -1)
 		{
-			low = sentinelCycle.back();
-			assert(low_array[low] != Globals::BIG_INT);
-			sentinelCycle = list_sym_diff(sentinelCycle, redBoundary[low_array[low]]);
+			if (low_array[low] == Globals::BIG_INT) // essential edge
+			{
+				annotation.set(essentialBits.at(low));
+				sentinelCycle.flip(low);
+				const MatrixListType & edge = cell2v_list[low];
+				u = edge[0];
+				v = edge[1];
+				while (u != v)
+				{
+					if (essentialForest.depth[u] < essentialForest.depth[v])
+						SWAP(u, v);
+					sentinelCycle.flip(essentialForest.parentEdge[u]);
+					u = essentialForest.parent[u];
+				}
+				continue;
+			}
+
+			sentinelCycle.flip(redBoundary[low_array[low]]);
 
 			if (low_array[low] >= death)
 			{
 				int currentColumnIdx = mapColorColumnIdx.at(low_array[low]);
-				int deathColumnIdx = mapColorColumnIdx.at(death);
 				annotation.set(currentColumnIdx - deathColumnIdx); // set the corresponding bit to be 1 
 			}
 		}
-
-		// finally, construct the map which associates the edge with its annotation
-		thread_mutex.lock();
-		resEdgeAnnotations.insert({ std::make_pair(edge.first, edge.second), annotation });
-		thread_mutex.unlock();
 	}
 }
 
@@ -342,34 +430,38 @@ void computeAnnotations(const vector<MatrixListType> & redBoundary, const map<pa
 
 	// next, for each sentinel edge, find its unique sentinel cycle in the spanning tree.
 	// Afterwards, compute the annotation of this sentinel edge
-	MatrixListType sentinelCycle;
+	rootedTree tree;
+	computeRootedTree(spanningTree, edgeMap, tree);
+
 	map<int, int> mapColorColumnIdx;
 	int bettiNum = computeBettiNumber(redBoundary, redBoundary[death].back(), death, mapColorColumnIdx);
-	BitSet annotation(bettiNum); // annotation, organized with bit vector
-
-	// dispatch tasks to workers
-	int num_workers = Globals::num_threads;
-	vector<vector<pair<int, int>>> batch_sentinelEdges;
-	int batch_size = sentinelEdges.size() / num_workers;
-	for (int i = 0; i < num_workers - 1; i++)
-	{
-		batch_sentinelEdges.push_back(vector<pair<int, int>>());
-		std::copy(sentinelEdges.begin() + i * batch_size, sentinelEdges.begin() + (i + 1)*batch_size, std::back_inserter(batch_sentinelEdges[i]));
-	}
-	batch_sentinelEdges.push_back(vector<pair<int, int>>());
-	std::copy(sentinelEdges.begin() + (num_workers - 1) * batch_size, sentinelEdges.end(), std::back_inserter(batch_sentinelEdges[num_workers - 1]));
 
-	// creat workers
-	std::vector<std::thread> threadList;
-	for (int i = 0; i < num_workers; i++)
-	{
-		threadList.push_back(std::thread(threadComputeAnnotation, ref(batch_sentinelEdges[i]),
-			ref(spanningTree), ref(edgeMap), ref(low_array), death, bettiNum, ref(redBoundary), ref(mapColorColumnIdx),
-			ref(resEdgeAnnotations)));
-	}
-
-	// wait workers to finish
-	std::for_each(threadList.begin(), threadList.end(), std::mem_fn(&std::thread::join));
+	// the classes which never die get their own bits, after the colored columns
+	rootedTree essentialForest;
+	vector<int> essentialEdges;
+	computeEssentialEdges(cell2v_list, low_array, low, vertexNum, edgeMap, essentialForest, essentialEdges);
+	map<int, int> essentialBits;
+	for (const auto & e : essentialEdges)
+		essentialBits[e] = bettiNum++;
+
+	// The sentinel cycles differ a lot in length, so the edges are cut into many small ranges which
+	// the workers of the thread pool steal from each other. Every edge owns a slot in annotations,
+	// so the workers never need a lock. If we are already running inside a worker (homology classes
+	// are processed in parallel), the ranges are simply handled by this thread.
+	int numEdges = sentinelEdges.size();
+	vector<BitSet> annotations(numEdges, BitSet(bettiNum));
+	int numRanges = std::min(numEdges, 8 * getThreadPool().size());
+	getThreadPool().run(numRanges, [&](int task, int) {
+		int first = (long long)numEdges * task / numRanges;
+		int last = (long long)numEdges * (task + 1) / numRanges;
+		threadComputeAnnotation(sentinelEdges, first, last, tree, low + 1, edgeMap, low_array, death,
+			redBoundary, cell2v_list, mapColorColumnIdx, essentialForest, essentialBits, annotations);
+	});
+
+	// finally, construct the map which associates the edges with their annotations;
+	// sentinelEdges is sorted, so every insertion happens at the end of the map
+	for (int i = 0; i < numEdges; i++)
+		resEdgeAnnotations.emplace_hint(resEdgeAnnotations.end(), sentinelEdges[i], std::move(annotations[i]));
 }
 
 
@@ -410,150 +502,236 @@ void computeCycleAnnotation(const MatrixListType & inputCycle, const vector<Matr
 }
 
 
+// Compact (CSR) adjacency of the graph formed by the edges below 'low'. 
+// Besides the neighbor, each entry keeps the index of the connecting edge, so that
+// its annotation can be looked up without querying by endpoints.
+struct edgeGraph
+{
+	vector<int> offsets;							// the neighbors of vertex v are stored in [offsets[v], offsets[v+1])
+	vector<int> targets;							// the neighbor vertices
+	vector<int> edges;								// the connecting edges (indices into cell2v_list)
+};
+
+
+// A pattern database: the distances to the target in the covering graph of a group of annotation entries
+struct patternDatabase
+{
+	vector<int> entries;							// the annotation entries covered by this database
+	vector<int> distance;							// distance[sheet * vertexNum + v], -1 if the target is unreachable
+};
+
+
 /********************************************************************
-* Description:	Given edge annotations and entry index, construct the 1d-version convering graph.
-						The input original graph is specified by cell2v_list and low index, which together
-						define the edge set of original graph.
+* Description:	Given cell2v_list and low index, which together define the edge set of a graph,
+						construct its compact adjacency.
 * Parameters:
-* - edgeAnnotations:		the input edge annotations
 * - cell2v_list:				a converter which projects cells to their corresponding constituent vertices
-* - low:							the low index of a homology class
-* - entryIdx:					the entry index
+* - low:							the low index of a homology class (the 'low' edge is excluded)
 * - vertexNum:				the number of vertices
-* - resCoveringGraph:	the result 1d covering graph
+* - resGraph:					the result graph
+* - windowMask:				if given, only the edges with both endpoints inside the window are kept
 ********************************************************************/
-void constructCoveringGraph1D(const map<pair<int, int>, BitSet> & edgeAnnotations, const vector<MatrixListType> & cell2v_list,
-	int low, int entryIdx, int vertexNum, adjacency_list_t & resCoveringGraph)
+void constructEdgeGraph(const vector<MatrixListType> & cell2v_list, int low, int vertexNum, edgeGraph & resGraph,
+	const vector<char> * windowMask = nullptr)
 {
-	resCoveringGraph.clear();
-	resCoveringGraph.resize(2*vertexNum); // for 1d covering graph, we have two copies of original graph
+	auto isInWindow = [&](int i) {
+		return windowMask == nullptr || ((*windowMask)[cell2v_list[i][0]] && (*windowMask)[cell2v_list[i][1]]);
+	};
 
-	MatrixListType edge;
-	pair<int, int> key;
-	int ptr_1, ptr_2;
-	map<pair<int, int>, BitSet>::const_iterator it_annotation;
-	
-	for (size_t i = 0; i < low; i++) // we do not need to consider the 'low' edge
+	resGraph.offsets.assign(vertexNum + 1, 0);
+	for (int i = 0; i < low; i++) // count the degrees first
 	{
-		edge = cell2v_list[i];
-		ptr_1 = edge[0];
-		ptr_2 = edge[1];
-		if (ptr_1 > ptr_2)
-			SWAP(ptr_1, ptr_2);
+		if (!isInWindow(i))
+			continue;
+		resGraph.offsets[cell2v_list[i][0] + 1]++;
+		resGraph.offsets[cell2v_list[i][1] + 1]++;
+	}
+	for (int v = 0; v < vertexNum; v++)
+		resGraph.offsets[v + 1] += resGraph.offsets[v];
 
-		key.first = ptr_1;
-		key.second = ptr_2;
+	resGraph.targets.resize(resGraph.offsets[vertexNum]);
+	resGraph.edges.resize(resGraph.offsets[vertexNum]);
+	vector<int> fill(resGraph.offsets.begin(), resGraph.offsets.end() - 1);
+	for (int i = 0; i < low; i++)
+	{
+		if (!isInWindow(i))
+			continue;
+		int u = cell2v_list[i][0];
+		int v = cell2v_list[i][1];
 
-		// check if it is sentinel edge
-		it_annotation = edgeAnnotations.find(key);
-		if (it_annotation == edgeAnnotations.end() || (it_annotation->second).checkBit(entryIdx) == false) // it is not a sentinel edge, or the bit at the given entry is 0
-		{
-			// first copy
-			resCoveringGraph[edge[0]].push_back(neighbor(edge[1]));
-			resCoveringGraph[edge[1]].push_back(neighbor(edge[0]));
+		resGraph.targets[fill[u]] = v;
+		resGraph.edges[fill[u]++] = i;
+		resGraph.targets[fill[v]] = u;
+		resGraph.edges[fill[v]++] = i;
+	}
+}
 
-			// second copy
-			resCoveringGraph[edge[0] + vertexNum].push_back(neighbor(edge[1] + vertexNum));
-			resCoveringGraph[edge[1] + vertexNum].push_back(neighbor(edge[0] + vertexNum));
-		}
-		else
+
+/********************************************************************
+* Description:	Apply backward BFS, starting from the target, on the covering graph of a group of
+						annotation entries. The covering graph is implicit: it has 2^k copies (sheets) of
+						the original graph, and crossing edge e moves from sheet s to sheet s ^ edgeMask[e].
+						The distance from every vertex of it to the target is recorded in a dense table.
+* Parameters:
+* - source:						the 'target' vertex in original graph
+* - graph:						the original graph
+* - edgeMask:				the annotation of each edge, restricted to the entries of this group
+* - numSheets:				the number of sheets, i.e. 2^k
+* - resDistance:				the result distance table (-1 for vertices which cannot reach the target)
+********************************************************************/
+void BFS_Pattern_Table(int source, const edgeGraph & graph, const vector<int> & edgeMask, int numSheets,
+	vector<int> & resDistance)
+{
+	int vertexNum = graph.offsets.size() - 1;
+	resDistance.assign((size_t)numSheets * vertexNum, -1);
+
+	vector<int> searchQ; // BFS queue, every vertex enters it at most once
+	searchQ.reserve(resDistance.size());
+
+	searchQ.push_back(source); // backward BFS, from the target in sheet 0
+	resDistance[source] = 0;
+
+	int currNode, currVertex, currSheet, nbNode, pathLen;
+	for (size_t head = 0; head < searchQ.size(); ++head)
+	{
+		currNode = searchQ[head];
+		currVertex = currNode % vertexNum;
+		currSheet = currNode / vertexNum;
+		pathLen = resDistance[currNode];
+
+		// visit its neighbors
+		for (int k = graph.offsets[currVertex]; k < graph.offsets[currVertex + 1]; ++k)
 		{
-			// first copy
-			resCoveringGraph[edge[0]].push_back(neighbor(edge[1] + vertexNum));
-			resCoveringGraph[edge[1] + vertexNum].push_back(neighbor(edge[0]));
+			nbNode = (currSheet ^ edgeMask[graph.edges[k]]) * vertexNum + graph.targets[k];
+			if (resDistance[nbNode] != -1)
+				continue;
 
-			// second copy
-			resCoveringGraph[edge[0] + vertexNum].push_back(neighbor(edge[1]));
-			resCoveringGraph[edge[1]].push_back(neighbor(edge[0] + vertexNum));
+			resDistance[nbNode] = pathLen + 1;
+			searchQ.push_back(nbNode);
 		}
 	}
 }
 
 
 /********************************************************************
-* Description:	Apply backward BFS on unweighted graph to find the length of shortest path
-						between two vertices. During this process, we also record the distance from
-						other vertices to the target, which will be used for building heuristic database.
+* Description:	compute the distance table of one pattern database
 * Parameters:
-* - source:						the 'target' vertex in original graph
-* - target:						the 'source' vertex in original graph
-* - coveringGraph:			the input covering graph
-* - heuristic_database:	the heuristic database
+* - resDatabase:			the pattern database, whose entries are given
+* - edgeAnnotationList:	the annotation of each edge (nullptr for non-sentinel edges)
+* - other parameters are the same as computePatternDatabases
 ********************************************************************/
-int BFS_Shortest_Path_Length(int source, int target, const adjacency_list_t & coveringGraph,
-	unordered_map<int, int> & heuristic_database)
+void computePatternDatabase(const edgeGraph & graph, const vector<const BitSet *> & edgeAnnotationList, int target,
+	patternDatabase & resDatabase)
 {
-	// first, check if the distance from source to target has been computed before
-	unordered_map<int, int>::const_iterator hash_it;
-	hash_it = heuristic_database.find(target);
-	if (hash_it != heuristic_database.end())
-		return hash_it->second;
+	const vector<int> & entries = resDatabase.entries;
+	vector<int> edgeMask(edgeAnnotationList.size(), 0);
+	for (size_t i = 0; i < edgeAnnotationList.size(); ++i)
+	{
+		if (edgeAnnotationList[i] == nullptr)
+			continue;
 
-	// otherwise, we need to do BFS to find the path length
-	int vertexNum = coveringGraph.size();
+		for (size_t j = 0; j < entries.size(); ++j)
+		{
+			if (edgeAnnotationList[i]->checkBit(entries[j]))
+				edgeMask[i] |= (1 << j);
+		}
+	}
 
-	unordered_set<int> hasVisited;
-	queue<int> searchQ;
+	BFS_Pattern_Table(target, graph, edgeMask, 1 << entries.size(), resDatabase.distance);
+}
 
-	searchQ.push(source); // backward BFS
-	hasVisited.insert(source);
-	heuristic_database[source] = 0;
 
-	int currNode, neighborNode;
-	int pathLen = -1;
+/********************************************************************
+* Description:	Split the annotation entries into groups of Globals::pattern_size entries, and for
+						each group compute the distances from all the vertices of its 2^k-sheet covering
+						graph to the target up front. The group size is reduced until the databases fit
+						into Globals::pattern_memory (MB). With groups of one entry this gives the classical
+						1d covering graph heuristic. The databases are computed by the shared thread pool.
+* Parameters:
+* - edgeAnnotations:		the input edge annotations
+* - cell2v_list:				a converter which projects cells to their corresponding constituent vertices
+* - graph:						the graph formed by the edges below 'low'
+* - low:							the low index of a homology class
+* - target:						the target of search
+* - BettiNum:					the Betti number
+* - resDatabases:			the result pattern databases
+********************************************************************/
+void computePatternDatabases(const map<pair<int, int>, BitSet> & edgeAnnotations, const vector<MatrixListType> & cell2v_list,
+	const edgeGraph & graph, int low, int target, int BettiNum, vector<patternDatabase> & resDatabases)
+{
+	resDatabases.clear();
+
+	int vertexNum = graph.offsets.size() - 1;
 
-	while (true)
+	// choose the largest group size which fits into the memory budget
+	int groupSize = std::max(1, std::min(std::min(Globals::pattern_size, BettiNum), 16));
+	while (groupSize > 1)
 	{
-		currNode = searchQ.front();
-		searchQ.pop();
-		pathLen = heuristic_database.at(currNode);
+		double memory = 0;
+		for (int first = 0; first < BettiNum; first += groupSize)
+			memory += double(1 << std::min(groupSize, BettiNum - first)) * vertexNum * sizeof(int);
 
-		if (currNode == target)
-			return pathLen;
+		if (memory / (1 << 20) <= Globals::pattern_memory && (double(1 << groupSize) * vertexNum) < INT_MAX)
+			break;
+		groupSize--;
+	}
 
-		// visit its neighbors
-		const std::vector<neighbor> & neighbors = coveringGraph[currNode];
-		for (const auto & nb : neighbors)
-		{
-			if (hasVisited.find(nb.target) != hasVisited.end())
-				continue;
+	for (int first = 0; first < BettiNum; first += groupSize)
+	{
+		resDatabases.push_back(patternDatabase());
+		for (int i = first; i < std::min(first + groupSize, BettiNum); ++i)
+			resDatabases.back().entries.push_back(i);
+	}
 
-			hasVisited.insert(nb.target);
-			searchQ.push(nb.target);
-			heuristic_database[nb.target] = pathLen + 1;
-		}
+	// look up the annotation of each edge once
+	vector<const BitSet *> edgeAnnotationList(low, nullptr);
+	pair<int, int> key;
+	map<pair<int, int>, BitSet>::const_iterator it_annotation;
+	for (int i = 0; i < low; i++)
+	{
+		key.first = std::min(cell2v_list[i][0], cell2v_list[i][1]);
+		key.second = std::max(cell2v_list[i][0], cell2v_list[i][1]);
+
+		it_annotation = edgeAnnotations.find(key);
+		if (it_annotation != edgeAnnotations.end())
+			edgeAnnotationList[i] = &(it_annotation->second);
 	}
+
+	getThreadPool().run(resDatabases.size(), [&](int idx, int) {
+		computePatternDatabase(graph, edgeAnnotationList, target, resDatabases[idx]);
+	});
 }
 
 
 /********************************************************************
 * Description:	Given source and target, compute the length of shortest path between them.
 						This shortest path should have the same annotation as target annotation.
+						Each pattern database gives a lower bound, and we take the maximum of them.
 * Parameters:
-* - coveringGraphs:		a vector containing different 1d covering graphs
+* - databases:				the precomputed pattern databases
 * - targetAnnotation:		target annotation from source to target
 * - source:						the given source
-* - target:						the given target
-* - BettiNum:					the Betti number
 * - vertexNum:				the number of vertices
-* - heuristic_database:	heuristic database
+* Return -1 if no path with the target annotation exists.
 ********************************************************************/
-int computeHeuristic(const vector<adjacency_list_t> & coveringGraphs, const BitSet & targetAnnotation,
-	int source, int target, int BettiNum, int vertexNum, vector<unordered_map<int, int>> & heuristic_database)
+int computeHeuristic(const vector<patternDatabase> & databases, const BitSet & targetAnnotation,
+	int source, int vertexNum)
 {
-	assert(coveringGraphs.size() == BettiNum);
-
-	int currH, maxH = -1;
-	int u = target, v; // backward search from target to source
+	int currH, maxH = 0;
+	int sheet;
 
-	for (int i = 0; i < BettiNum; i++)
+	for (const auto & pdb : databases)
 	{
-		if (targetAnnotation.checkBit(i) == false) // compute the path with even number of edges from Ei
-			v = source;
-		else
-			v = source + vertexNum;
+		sheet = 0;
+		for (size_t j = 0; j < pdb.entries.size(); ++j)
+		{
+			if (targetAnnotation.checkBit(pdb.entries[j])) // compute the path with odd number of edges from E_j
+				sheet |= (1 << j);
+		}
 
-		currH = BFS_Shortest_Path_Length(u, v, coveringGraphs[i], heuristic_database[i]);
+		currH = pdb.distance[sheet * vertexNum + source];
+		if (currH < 0) // the target is not reachable with this annotation
+			return -1;
 		if (maxH < currH)
 			maxH = currH;
 	}
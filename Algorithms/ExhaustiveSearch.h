@@ -6,6 +6,9 @@
 #include <vector>
 #include <fstream>
 #include <ctime>
+#include <unordered_map>
+#include <chrono>
+#include <sstream>
 
 #include "../Filtration/CubicalFiltration.h"
 #include "../PersistenceIO.h"
@@ -14,108 +17,63 @@
 #include "../BitSet.h"
 #include "AStar.h"
 #include "../Globals.h"
+#include "../ThreadPool.h"
 
 #include "../External/Mem_usage.h"
 
 
-// convert annotation to integer
-int convertAnnotation2Int(const BitSet & vertexAnnotation)
+typedef unsigned long long annotationWord; // an annotation packed into a machine word (BettiNum <= 64)
+
+
+// convert annotation to a machine word
+annotationWord convertAnnotation2Word(const BitSet & vertexAnnotation)
 {
-	double pos = 0;
+	annotationWord word = 0;
 	for (int i = 0; i < vertexAnnotation.getBitSize(); ++i)
 	{
 		if (vertexAnnotation.checkBit(i) == true)
-			pos += pow(2.0, (double)i);
+			word |= (annotationWord(1) << i);
 	}
-	return (int)pos;
+	return word;
 }
 
 
-// convert integer to annotation
-BitSet convertInt2Annotation(int pos, int BettiNum)
+// Hasher for the vertices (vertex, annotation word) of covering graph
+struct CoveringVertexHasher
 {
-	BitSet resAnnotation(BettiNum);
-	int idx = 0;
-	int bit;
-
-	while (pos != 0)
+	std::size_t operator () (const std::pair<int, annotationWord> & key) const
 	{
-		bit = pos % 2;
-		if (bit == 1)
-			resAnnotation.set(idx);
+		size_t res = 17;
+		res = res * 31 + std::hash<int>()(key.first);
+		res = res * 31 + std::hash<annotationWord>()(key.second);
 
-		pos = pos >> 1;
-		idx++;
+		return res;
 	}
-	return resAnnotation;
-}
-
-// construct the whole covering graph
-void constructCoveringGraph(const map<pair<int, int>, BitSet> & edgeAnnotations, int low,
-	int vertexNum, const vector<MatrixListType> & cell2v_list, adjacency_list_t & resCoveringGraph)
-{
-	int BettiNum = (edgeAnnotations.cbegin()->second).getBitSize();
-	int numCopy = pow(2.0, double(BettiNum));
-
-	resCoveringGraph.clear();
-	resCoveringGraph.resize(vertexNum * numCopy);
-
-	MatrixListType edge;
-	pair<int, int> key;
-	int ptr_1, ptr_2;
-	int vCopyPos;
-	BitSet tempAnnotation(BettiNum);
-	map<pair<int, int>, BitSet>::const_iterator it_annotation;
-
-	for (int i = 0; i < low; ++i)
-	{
-		edge = cell2v_list[i];
-
-		ptr_1 = edge[0];
-		ptr_2 = edge[1];
+};
 
-		if (ptr_1 > ptr_2)
-			SWAP(ptr_1, ptr_2);
-
-		key.first = ptr_1;
-		key.second = ptr_2;
-
-		// check if it is sentinel edge
-		it_annotation = edgeAnnotations.find(key);
-
-		if (it_annotation == edgeAnnotations.end()) // Not a sentinel edge
-		{
-			for (int j = 0; j < numCopy; ++j)
-			{
-				resCoveringGraph[ptr_1 + j * vertexNum].push_back(neighbor(ptr_2 + j * vertexNum));
-				resCoveringGraph[ptr_2 + j * vertexNum].push_back(neighbor(ptr_1 + j * vertexNum));
-			}
-		}
-		else // A sentinel edge
-		{
-			for (int j = 0; j < numCopy; ++j)
-			{
-				tempAnnotation = convertInt2Annotation(j, BettiNum);
-				tempAnnotation ^= it_annotation->second;
-				vCopyPos = convertAnnotation2Int(tempAnnotation);
-
-				resCoveringGraph[ptr_1 + j * vertexNum].push_back(neighbor(ptr_2 + vCopyPos * vertexNum));
-				resCoveringGraph[ptr_2 + vCopyPos * vertexNum].push_back(neighbor(ptr_1 + j * vertexNum));
-			}
-		}
-	}
-}
 
 // the algorithm of exhautive search
-void ExhaustiveSearch(const adjacency_list_t & coveringGraph, const MatrixListType & inputCycle, const vector<MatrixListType> & cell2v_list,
+// The covering graph is never materialized: its vertices are (vertex, annotation word) pairs, and the neighbors
+// of (v, w) are (u, w ^ a(uv)) for every edge uv of the original graph. Since all edges have unit weight,
+// BFS from (source, 0) finds the shortest path to (target, targetAnnotation), and only the visited part of
+// the covering graph is stored. Returns whether the result is proven to be optimal (within the search window
+// the graph was built for); if the search budget is exhausted first, the input cycle is returned instead, and
+// if the target cannot be reached inside the window, the result is empty. If budget is given, the search
+// shares it with the other searches of the class (see searchBudget).
+bool ExhaustiveSearch(const edgeGraph & graph, const MatrixListType & inputCycle, const vector<MatrixListType> & cell2v_list,
 	const map<pair<int, int>, BitSet> & edgeAnnotations, int vertexNum, const std::map<std::pair<int, int>, int> & edgeMap,
-	MatrixListType & resShortestCycle)
+	MatrixListType & resShortestCycle, std::ostream & log = cout, const vector<char> * windowMask = nullptr,
+	searchBudget * budget = nullptr)
 {
 	resShortestCycle.clear();
 
 	assert(!edgeAnnotations.empty());
 	int BettiNum = (edgeAnnotations.cbegin()->second).getBitSize();
-
+	if (BettiNum > 64)
+	{
+		log << "Betti number " << BettiNum << " is too large for exhaustive search, use A* instead" << endl;
+		return AStar_Optimal_Cycle(inputCycle, cell2v_list, edgeAnnotations, edgeMap, vertexNum, resShortestCycle, log, windowMask, budget);
+	}
 
 	BitSet targetAnnotation(BettiNum); // the target annotation we should reach finally
 	computeCycleAnnotation(inputCycle, cell2v_list, edgeAnnotations, targetAnnotation);
@@ -133,68 +91,102 @@ void ExhaustiveSearch(const adjacency_list_t & coveringGraph, const MatrixListTy
 	if (it_annotation != edgeAnnotations.end()) // the pivot edge is a sentinel edge
 		targetAnnotation ^= it_annotation->second; // exclude the pivot edge
 
+	annotationWord targetWord = convertAnnotation2Word(targetAnnotation);
 
-	int targetCopy = convertAnnotation2Int(targetAnnotation);
-	target = target + targetCopy * vertexNum;
-
-	std::vector<vertex_t> previous; // used for backtracing the shortest path
-	std::vector<weight_t> min_distance; // used for recording the shortest distance
+	// look up the annotation word of each edge once
+	vector<annotationWord> edgeWord(low, 0);
+	for (int i = 0; i < low; ++i)
+	{
+		key.first = std::min(cell2v_list[i][0], cell2v_list[i][1]);
+		key.second = std::max(cell2v_list[i][0], cell2v_list[i][1]);
 
-	// Apply Dijkstra's algorithm
-	DijkstraComputePaths(source, target, coveringGraph, min_distance, previous);
+		it_annotation = edgeAnnotations.find(key);
+		if (it_annotation != edgeAnnotations.end()) // a sentinel edge
+			edgeWord[i] = convertAnnotation2Word(it_annotation->second);
+	}
 
-	// Backtrace the shortest path
-	std::list<vertex_t> path = DijkstraGetShortestPathTo(target, previous);
-	int ptr_1, ptr_2, resEdge;
-	for (std::list<vertex_t>::iterator it = path.begin(); it != std::prev(path.end()); it++)
+	// Apply BFS on the implicit covering graph
+	vector<pair<int, annotationWord>> states; // the visited covering graph vertices, in BFS order
+	vector<int> parentState; // used for backtracing the shortest path
+	vector<int> parentEdge; // the edge through which a state is reached
+	unordered_map<pair<int, annotationWord>, int, CoveringVertexHasher> stateIndex;
+
+	states.push_back(std::make_pair(source, annotationWord(0)));
+	parentState.push_back(-1);
+	parentEdge.push_back(-1);
+	stateIndex.insert({ states.back(), 0 });
+
+	searchBudget ownBudget;
+	if (budget == nullptr)
+		budget = &ownBudget;
+	const char * exhaustedBudget = nullptr;
+	std::size_t bytesPerState = sizeof(pair<int, annotationWord>) + 2 * sizeof(int) // states, parentState, parentEdge
+		+ sizeof(pair<int, annotationWord>) + sizeof(int) + 2 * sizeof(void *); // entry in stateIndex
+
+	int goal = -1;
+	int currVertex, nbVertex;
+	annotationWord currWord, nbWord;
+	for (size_t head = 0; head < states.size() && goal == -1; ++head)
 	{
-		ptr_1 = (*it) % vertexNum;
-		ptr_2 = (*(std::next(it))) % vertexNum;
+		exhaustedBudget = budget->exhausted(states.size() * bytesPerState);
+		if (exhaustedBudget != nullptr)
+		{
+			log << "Search " << exhaustedBudget << " budget exhausted, keep the reduced cycle (not proven optimal)" << endl;
+			resShortestCycle = inputCycle;
+			return false;
+		}
 
-		if (ptr_1 > ptr_2) // sort
-			SWAP(ptr_1, ptr_2);
+		currVertex = states[head].first;
+		currWord = states[head].second;
 
-		std::pair<int, int> endPtrs(ptr_1, ptr_2);
-		resEdge = edgeMap.at(endPtrs);
-		resShortestCycle.push_back(resEdge);
-	}
+		for (int k = graph.offsets[currVertex]; k < graph.offsets[currVertex + 1]; ++k)
+		{
+			nbVertex = graph.targets[k];
+			nbWord = currWord ^ edgeWord[graph.edges[k]];
 
-	// Add the pivot edge
-	resShortestCycle.push_back(low);
-	mysort(resShortestCycle);
+			if (!stateIndex.insert({ std::make_pair(nbVertex, nbWord), (int)states.size() }).second) // visited before
+				continue;
 
-	std::size_t physMemUsed; // for monitoring the memory footprint
-	ofstream memoryFile(Globals::memoryFileName_ClassicalAlg, ios::out | ios::app);
-	clock_t currTime;
+			states.push_back(std::make_pair(nbVertex, nbWord));
+			parentState.push_back(head);
+			parentEdge.push_back(graph.edges[k]);
 
-	physMemUsed = getPeakRSS() >> 20;
-	currTime = clock();
-	// memoryFile << (float)(currTime - startTime) / CLOCKS_PER_SEC << " " << physMemUsed / 1024.0 / 1024.0 << endl;
-	memoryFile << "Betti Number: " << BettiNum << "\t " << "Memory Footprint: " << physMemUsed << " (MB)" << endl;
+			if (nbVertex == target && nbWord == targetWord) // we reached the destination
+			{
+				goal = states.size() - 1;
+				break;
+			}
+		}
+	}
+	if (goal == -1) // only possible inside a search window
+	{
+		log << "No representative cycle inside the search window" << endl;
+		return false;
+	}
 
-	memoryFile.close();
+	// Backtrace the shortest path
+	for (int curr = goal; parentState[curr] != -1; curr = parentState[curr])
+		resShortestCycle.push_back(parentEdge[curr]);
 
-	// free memory
-	previous.clear();
-	min_distance.clear();
-	path.clear();
+	// Add the pivot edge
+	resShortestCycle.push_back(low);
+	mysort(resShortestCycle);
+	return true;
 }
 
 
 // interface for running classical annotation-based algorithm
-template<int arrayDim, int vertexDim = arrayDim>
-void reduceND_ExhaustiveSearch(blitz::Array<double, arrayDim> *phi, const vector<blitz::TinyVector<int, vertexDim>> & vList,
+// The homology classes are processed in parallel, see reduceND_AStar.
+template<int arrayDim, int vertexDim = arrayDim, typename VertexListT>
+void reduceND_ExhaustiveSearch(blitz::Array<double, arrayDim> *phi, const VertexListT & vList,
 	const vector<int> & lowerCellList, const vector<CellNrType> & upperCellList, vector<MatrixListType> & boundaryMatrix,
 	const std::map<std::pair<int, int>, int> & edgeMap, const vector<MatrixListType> &cell2v_list, int vertexNum,
-	vector<int> &low_array)
+	vector<int> &low_array, vector<int> & cycleStatus, int windowHalo = 0)
 {
-	clock_t startClock, endClock;
-
 	cout << "--- Using Classical Annotation Algorithm (Exhaustive Search) ---" << endl;
-	ofstream memoryFile(Globals::memoryFileName_ClassicalAlg, ios::out | ios::trunc);
-	memoryFile.close();
 
-	std::map<int, MatrixListType> resCycles;
+	// -- collect the homology classes to be optimized
+	vector<int> classList;
 	for (int test = 0; test < boundaryMatrix.size(); test++)
 	{
 		if (boundaryMatrix[test].empty())
@@ -202,37 +194,62 @@ void reduceND_ExhaustiveSearch(blitz::Array<double, arrayDim> *phi, const vector
 
 		double birthTime, deathTime;
 		double pers = computePersistence<arrayDim, vertexDim>(phi, vList, lowerCellList, upperCellList, boundaryMatrix, test, birthTime, deathTime);
-		if (pers <= Globals::reduction_threshold)
-			continue;
+		if (pers > Globals::reduction_threshold)
+			classList.push_back(test);
+	}
 
-		// We first compute the annotations of all edges
-		cout << "---------------------------------------" << endl;
-		cout << "Compute edge annotations ..." << endl;
-		map<pair<int, int>, BitSet> edgeAnnotations;
-		computeAnnotations(boundaryMatrix, edgeMap, low_array, cell2v_list, test, vertexNum, edgeAnnotations);
+	vector<int> schedule;
+	scheduleByCost(boundaryMatrix, classList, schedule);
 
-		startClock = clock();
-		// Construct convering graph
-		cout << "Construct covering graph ..." << endl;
-		adjacency_list_t coveringGraph;
-		constructCoveringGraph(edgeAnnotations, boundaryMatrix[test].back(), vertexNum, cell2v_list, coveringGraph);
+	vector<MatrixListType> resCycles(classList.size());
+	vector<string> logs(classList.size());
+	vector<int> BettiNums(classList.size());
+	vector<int> statusList(classList.size());
+	vector<std::size_t> physMemUsed(classList.size()); // the estimated peak memory of each search, for monitoring the memory footprint
 
-		cout << "Apply Exhaustive Search algorithm ..." << endl;
-		MatrixListType resCycle;
-		ExhaustiveSearch(coveringGraph, boundaryMatrix[test], cell2v_list, edgeAnnotations, vertexNum, edgeMap, resCycle);
-		cout << "Size before: " << boundaryMatrix[test].size() << endl;
-		cout << "Size after: " << resCycle.size() << endl;
+	getThreadPool().run(schedule.size(), [&](int task, int) {
+		int idx = schedule[task];
+		int test = classList[idx];
+		std::ostringstream log;
 
-		endClock = clock();
-		cout << "Time consumed (s): " << (float)(endClock - startClock) / CLOCKS_PER_SEC << endl;
-		cout << "---------------------------------------" << endl;
+		// We first compute the annotations of all edges
+		log << "---------------------------------------" << endl;
+		log << "Compute edge annotations ..." << endl;
+		map<pair<int, int>, BitSet> edgeAnnotations;
+		computeAnnotations(boundaryMatrix, edgeMap, low_array, cell2v_list, test, vertexNum, edgeAnnotations);
+		BettiNums[idx] = (edgeAnnotations.cbegin()->second).getBitSize();
+
+		auto startTime = std::chrono::steady_clock::now();
+		std::size_t peakMemory = 0;
+		log << "Apply Exhaustive Search algorithm ..." << endl;
+		statusList[idx] = searchInWindow<vertexDim>(vList, cell2v_list, boundaryMatrix[test], windowHalo, resCycles[idx], peakMemory, log,
+			[&](const vector<char> * windowMask, searchBudget & budget) {
+			// Construct the original graph, the covering graph is implicit
+			edgeGraph graph;
+			constructEdgeGraph(cell2v_list, boundaryMatrix[test].back(), vertexNum, graph, windowMask);
+			return ExhaustiveSearch(graph, boundaryMatrix[test], cell2v_list, edgeAnnotations, vertexNum, edgeMap, resCycles[idx], log, windowMask, &budget);
+		});
+		log << "Size before: " << boundaryMatrix[test].size() << endl;
+		log << "Size after: " << resCycles[idx].size() << endl;
+
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+		log << "Time consumed (s): " << elapsed.count() << endl;
+		log << "---------------------------------------" << endl;
+
+		physMemUsed[idx] = peakMemory >> 20;
+		logs[idx] = log.str();
+	});
 
-		resCycles.insert({ test, resCycle });
-	}
-	for (const auto & cycle : resCycles)
+	ofstream memoryFile(Globals::memoryFileName_ClassicalAlg, ios::out | ios::trunc);
+	for (size_t idx = 0; idx < classList.size(); idx++)
 	{
-		boundaryMatrix[cycle.first] = cycle.second;
+		cout << logs[idx];
+		memoryFile << "Betti Number: " << BettiNums[idx] << "\t " << "Memory Footprint: " << physMemUsed[idx] << " (MB)"
+			<< "\t " << "Optimal: " << cycleStatusName(statusList[idx]) << endl;
+		boundaryMatrix[classList[idx]] = resCycles[idx];
+		cycleStatus[classList[idx]] = statusList[idx];
 	}
+	memoryFile.close();
 }
 
 #endif // !PAPER2012_H
@@ -74,7 +74,12 @@ public:
 
 	BitSet & operator = (const BitSet & rhs) 
 	{
-		if (this != &rhs) {
+		if (this != &rhs && mBits != nullptr && mAllocatedSize == rhs.mAllocatedSize) // same size, reuse the buffer
+		{
+			mBitsize = rhs.mBitsize;
+			memcpy(mBits, rhs.mBits, mAllocatedSize);
+		}
+		else if (this != &rhs) {
 			mAllocatedSize = rhs.mAllocatedSize;
 			mBitsize = rhs.mBitsize;
 
@@ -311,6 +316,18 @@ public:
 		return sum;
 	}
 
+	// Hash all the bytes (FNV-1a), used for hashing annotations
+	size_t hashValue() const
+	{
+		size_t h = 14695981039346656037ULL;
+		for (int i = 0; i < mAllocatedSize; ++i)
+		{
+			h ^= mBits[i];
+			h *= 1099511628211ULL;
+		}
+		return h;
+	}
+
 private:
 	unsigned char* mBits = nullptr; // The array storing the bits
 	
@@ -2,11 +2,38 @@
 #define DATA_READER_FULL_RIPS_H
 
 #include <vector>
+#include <climits>
 using namespace std;
 
+
+/********************************************************************
+* Readers of a dense distance matrix. Only the distances d(i, j) with i < j are kept, packed
+* after n zeros for the points (the diagonal) in the layout of SparseEdgeList::filtrationValues:
+* d(i, j) is entry n + packedIndex(i, j, n), the pairs being in lexicographic order.
+* The full matrix is never held in memory; it is read one row at a time.
+********************************************************************/
+inline long long packedIndex(int i, int j, int n) // i < j
+{
+	return (long long)i * n - (long long)i * (i + 1) / 2 + (j - i - 1);
+}
+
+inline void resizePacked(int numPoints, blitz::Array<double, 1> &arr)
+{
+	long long size = numPoints + (long long)numPoints * (numPoints - 1) / 2;
+	if (size > INT_MAX)
+	{
+		std::cerr << "Too many points (" << numPoints << ") to index the pairs of a dense distance matrix." << endl;
+		exit(EXIT_FAILURE);
+	}
+	arr.resize((int)size);
+	for (int i = 0; i < numPoints; ++i)
+		arr(i) = 0.;
+}
+
+
 struct RawDataReaderFullRips
 {
-	void read(const string &file_name, blitz::Array<double, 2> &arr)
+	void read(const string &file_name, blitz::Array<double, 1> &arr)
 	{
 		std::ifstream f(file_name.c_str(), std::ios::binary | std::ios::in);
 
@@ -22,8 +49,14 @@ struct RawDataReaderFullRips
 			f.read(reinterpret_cast<char*>(posPoints[i].data()), sizeof(double)*dimPoints);
 		}
 
-		arr.resize(numPoints, numPoints);
-		f.read(reinterpret_cast<char*>(arr.data()), sizeof(double)*arr.size()); // read distance matrix
+		resizePacked(numPoints, arr);
+		vector<double> row(numPoints);
+		for (int i = 0; i < numPoints; ++i)
+		{
+			f.read(reinterpret_cast<char*>(row.data()), sizeof(double)*numPoints); // read distance matrix
+			for (int j = i + 1; j < numPoints; ++j)
+				arr(numPoints + packedIndex(i, j, numPoints)) = row[j];
+		}
 		
 		f.close();
 	}
@@ -32,7 +65,7 @@ struct RawDataReaderFullRips
 
 struct TextDataReaderFullRips
 {
-	void read(const string &file_name, blitz::Array<double, 2> &arr)
+	void read(const string &file_name, blitz::Array<double, 1> &arr)
 	{
 		std::ifstream f(file_name.c_str());
 
@@ -49,10 +82,16 @@ struct TextDataReaderFullRips
 			}
 		}
 
-		arr.resize(numPoints, numPoints);
-		for (blitz::Array<double, 2>::iterator it = arr.begin(), end = arr.end(); it != end; ++it)
+		resizePacked(numPoints, arr);
+		double dist;
+		for (int i = 0; i < numPoints; ++i)
 		{
-			f >> *it;
+			for (int j = 0; j < numPoints; ++j)
+			{
+				f >> dist;
+				if (j > i)
+					arr(numPoints + packedIndex(i, j, numPoints)) = dist;
+			}
 		}
 
 		f.close();
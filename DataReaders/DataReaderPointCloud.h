@@ -0,0 +1,303 @@
+#ifndef DATA_READER_POINT_CLOUD_H
+#define DATA_READER_POINT_CLOUD_H
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "ThreadPool.h"
+#include "DataReaders/DataReaderSparseRips.h"
+using namespace std;
+
+
+/********************************************************************
+* A point cloud, whose Rips filtration is computed from the Minkowski distances of the points
+* (Globals::minkowski_p) instead of a precomputed distance matrix. File layout:
+*   text:   4 numPoints dimPoints, followed by the coordinates of each point
+*   binary: int 4, int numPoints, int dimPoints, followed by the coordinates (doubles) of each point
+* The coordinates are stored coordinate by coordinate (coords[k * numPoints + i] is coordinate
+* k of point i), so that the distances from one point to a block of consecutive points are
+* computed by loops over contiguous memory, which the compiler vectorizes.
+********************************************************************/
+struct PointCloud
+{
+	int numPoints = 0;
+	int dimPoints = 0;
+	vector<double> coords;	// coordinate-major
+
+	static const int BLOCK_SIZE = 256; // the number of points whose distances are computed at once; the block stays in L1
+
+	// the smallest radius r such that some point is within distance r of all the other points
+	double enclosingRadius() const
+	{
+		vector<double> eccentricity(numPoints, 0.);
+		forEachBlock(0, [&](int i, int, int count, const double * dist) {
+			for (int j = 0; j < count; ++j)
+				eccentricity[i] = std::max(eccentricity[i], dist[j]);
+		});
+		return numPoints == 0 ? 0. : *std::min_element(eccentricity.begin(), eccentricity.end());
+	}
+
+	// the pairs of points within the given distance, as the edges of a sparse distance matrix
+	void edgeList(double threshold, SparseEdgeList &edgeList) const
+	{
+		collectEdges(edgeList, [threshold](int, int, double dist, double & value) {
+			value = dist;
+			return dist <= threshold;
+		});
+	}
+
+	// the greedy permutation of the points (farthest point sampling, from point 0): order[k] is the
+	// k-th point, and radii[k] its insertion radius, i.e., its distance to the points before it
+	// (infinite for the first point). The radii are nonincreasing.
+	void greedyPermutation(vector<int> &order, vector<double> &radii) const
+	{
+		order.clear();
+		radii.clear();
+		vector<double> nearest(numPoints, std::numeric_limits<double>::infinity()); // the distance of each point to the points taken so far
+		vector<pair<double, int>> farthest((numPoints + BLOCK_SIZE - 1) / BLOCK_SIZE); // the farthest point of each block
+
+		int next = 0;
+		double radius = std::numeric_limits<double>::infinity();
+		for (int k = 0; k < numPoints; ++k)
+		{
+			order.push_back(next);
+			radii.push_back(radius);
+			forEachBlockFrom(next, [&](int first, int count, const double * dist) {
+				pair<double, int> best(-1., -1);
+				for (int j = 0; j < count; ++j)
+				{
+					nearest[first + j] = std::min(nearest[first + j], dist[j]);
+					if (nearest[first + j] > best.first)
+						best = std::make_pair(nearest[first + j], first + j);
+				}
+				farthest[first / BLOCK_SIZE] = best;
+			});
+
+			vector<pair<double, int>>::const_iterator it = std::max_element(farthest.begin(), farthest.end(),
+				[](const pair<double, int> & a, const pair<double, int> & b) {return a.first < b.first;});
+			radius = it->first;
+			next = it->second;
+		}
+	}
+
+	// the edges of the sparse Rips filtration of the points (Cavanna, Jahanseir and Sheehy, "A geometric
+	// perspective on sparse filtrations"), whose diagram is within a factor 1 / (1 - epsilon) of the Rips
+	// diagram. A point p with insertion radius r_p in the greedy permutation is only connected to the points
+	// inserted before it within distance (r_p + r_q) / epsilon, and the edges between points that are
+	// far apart compared to their radii appear later than their length; so the number of edges is linear
+	// in the number of points. The edges longer than the threshold are dropped.
+	void sparseEdgeList(double epsilon, double threshold, SparseEdgeList &edgeList) const
+	{
+		vector<int> order;
+		vector<double> radii;
+		greedyPermutation(order, radii);
+
+		vector<double> pointRadius(numPoints); // the insertion radius of each point
+		vector<int> rank(numPoints); // the position of each point in the greedy permutation
+		for (int k = 0; k < numPoints; ++k)
+		{
+			pointRadius[order[k]] = radii[k];
+			rank[order[k]] = k;
+		}
+
+		collectEdges(edgeList, [&](int i, int j, double dist, double & value) {
+			double ri = pointRadius[i], rj = pointRadius[j]; // ri >= rj: i is inserted first
+			if (rank[i] > rank[j])
+				std::swap(ri, rj);
+
+			if (dist * epsilon <= 2 * rj)
+				value = dist;
+			else if (dist * epsilon > ri + rj)
+				return false;
+			else
+			{
+				value = 2 * (dist - rj / epsilon);
+				if (epsilon * value > 2 * ri)
+					return false;
+			}
+			return value <= threshold;
+		});
+	}
+
+private:
+	// the edges (i, j), i < j, for which select(i, j, distance, value) is true, with the value it sets
+	template<typename Select>
+	void collectEdges(SparseEdgeList &edgeList, const Select & select) const
+	{
+		vector<vector<pair<int, double>>> neighbors(numPoints); // the neighbors of each point with a bigger index
+		forEachBlock(1, [&](int i, int first, int count, const double * dist) {
+			double value;
+			for (int j = 0; j < count; ++j)
+				if (select(i, first + j, dist[j], value))
+					neighbors[i].push_back(std::make_pair(first + j, value));
+		});
+
+		edgeList.numPoints = numPoints;
+		edgeList.edges.clear();
+		edgeList.lengths.clear();
+		for (int i = 0; i < numPoints; ++i)
+		{
+			for (const auto & n : neighbors[i])
+			{
+				edgeList.edges.push_back(std::make_pair(i, n.first));
+				edgeList.lengths.push_back(n.second);
+			}
+			vector<pair<int, double>>().swap(neighbors[i]);
+		}
+	}
+
+	// the Minkowski distances, accumulated coordinate by coordinate
+	struct Manhattan
+	{
+		double accumulate(double acc, double diff) const { return acc + std::fabs(diff); }
+		double finish(double acc) const { return acc; }
+	};
+	struct Euclidean
+	{
+		double accumulate(double acc, double diff) const { return acc + diff * diff; }
+		double finish(double acc) const { return std::sqrt(acc); }
+	};
+	struct Chebyshev
+	{
+		double accumulate(double acc, double diff) const { return std::max(acc, std::fabs(diff)); }
+		double finish(double acc) const { return acc; }
+	};
+	struct General
+	{
+		double p;
+		double accumulate(double acc, double diff) const { return acc + std::pow(std::fabs(diff), p); }
+		double finish(double acc) const { return std::pow(acc, 1. / p); }
+	};
+
+	// the distances from point i to the points first .. first + count - 1
+	template<typename Metric>
+	void blockDistances(const Metric & metric, int i, int first, int count, double * dist) const
+	{
+		std::fill(dist, dist + count, 0.);
+		for (int k = 0; k < dimPoints; ++k)
+		{
+			const double x = coords[(size_t)k * numPoints + i];
+			const double * y = coords.data() + (size_t)k * numPoints + first;
+			for (int j = 0; j < count; ++j)
+				dist[j] = metric.accumulate(dist[j], x - y[j]);
+		}
+		for (int j = 0; j < count; ++j)
+			dist[j] = metric.finish(dist[j]);
+	}
+
+	// call f(i, first, count, dist) for the blocks of distances from every point i to the points
+	// from i + offset on (offset 0: to all the points), in parallel over the points
+	template<typename Function>
+	void forEachBlock(int offset, const Function & f) const
+	{
+		double p = Globals::minkowski_p;
+		if (p == 1)
+			forEachBlockWith(Manhattan(), offset, f);
+		else if (p == 2)
+			forEachBlockWith(Euclidean(), offset, f);
+		else if (std::isinf(p))
+			forEachBlockWith(Chebyshev(), offset, f);
+		else
+			forEachBlockWith(General{ p }, offset, f);
+	}
+
+	// call f(first, count, dist) for the blocks of distances from point i to all the points, in parallel over the blocks
+	template<typename Function>
+	void forEachBlockFrom(int i, const Function & f) const
+	{
+		double p = Globals::minkowski_p;
+		if (p == 1)
+			forEachBlockFromWith(Manhattan(), i, f);
+		else if (p == 2)
+			forEachBlockFromWith(Euclidean(), i, f);
+		else if (std::isinf(p))
+			forEachBlockFromWith(Chebyshev(), i, f);
+		else
+			forEachBlockFromWith(General{ p }, i, f);
+	}
+
+	template<typename Metric, typename Function>
+	void forEachBlockFromWith(const Metric & metric, int i, const Function & f) const
+	{
+		vector<vector<double>> buffers(getThreadPool().size(), vector<double>(BLOCK_SIZE));
+		int numBlocks = (numPoints + BLOCK_SIZE - 1) / BLOCK_SIZE;
+		getThreadPool().run(numBlocks, [&](int block, int worker) {
+			double * dist = buffers[worker].data();
+			int first = block * BLOCK_SIZE;
+			int count = std::min(BLOCK_SIZE, numPoints - first);
+			blockDistances(metric, i, first, count, dist);
+			f(first, count, dist);
+		});
+	}
+
+	template<typename Metric, typename Function>
+	void forEachBlockWith(const Metric & metric, int offset, const Function & f) const
+	{
+		vector<vector<double>> buffers(getThreadPool().size(), vector<double>(BLOCK_SIZE));
+		getThreadPool().run(numPoints, [&](int i, int worker) {
+			double * dist = buffers[worker].data();
+			int start = (offset == 0) ? 0 : i + offset;
+			for (int first = start; first < numPoints; first += BLOCK_SIZE)
+			{
+				int count = std::min(BLOCK_SIZE, numPoints - first);
+				blockDistances(metric, i, first, count, dist);
+				f(i, first, count, dist);
+			}
+		});
+	}
+};
+
+
+struct RawDataReaderPointCloud
+{
+	void read(const string &file_name, PointCloud &cloud)
+	{
+		std::ifstream f(file_name.c_str(), std::ios::binary | std::ios::in);
+
+		int fileType, numPoints, dimPoints;
+		f.read(reinterpret_cast<char*>(&fileType), sizeof(int));	 // read file type
+		f.read(reinterpret_cast<char*>(&numPoints), sizeof(int)); // read number of points
+		f.read(reinterpret_cast<char*>(&dimPoints), sizeof(int)); // read dimension of each point
+
+		cloud.numPoints = numPoints;
+		cloud.dimPoints = dimPoints;
+		cloud.coords.resize((size_t)numPoints * dimPoints);
+		vector<double> point(dimPoints);
+		for (int i = 0; i < numPoints; ++i)
+		{
+			f.read(reinterpret_cast<char*>(point.data()), sizeof(double)*dimPoints); // read point positions
+			for (int k = 0; k < dimPoints; ++k)
+				cloud.coords[(size_t)k * numPoints + i] = point[k];
+		}
+
+		f.close();
+	}
+};
+
+
+struct TextDataReaderPointCloud
+{
+	void read(const string &file_name, PointCloud &cloud)
+	{
+		std::ifstream f(file_name.c_str());
+
+		int fileType, numPoints, dimPoints;
+		f >> fileType >> numPoints >> dimPoints;
+
+		cloud.numPoints = numPoints;
+		cloud.dimPoints = dimPoints;
+		cloud.coords.resize((size_t)numPoints * dimPoints);
+		for (int i = 0; i < numPoints; ++i)
+		{
+			for (int k = 0; k < dimPoints; ++k)
+			{
+				f >> cloud.coords[(size_t)k * numPoints + i];
+			}
+		}
+
+		f.close();
+	}
+};
+
+#endif // !DATA_READER_POINT_CLOUD_H
@@ -0,0 +1,126 @@
+#ifndef DATA_READER_SPARSE_RIPS_H
+#define DATA_READER_SPARSE_RIPS_H
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+using namespace std;
+
+
+/********************************************************************
+* A sparse distance matrix, given as a weighted edge list (e.g., the edges of a k-nearest
+* neighbor graph, or the pairs of points closer than some distance). File layout:
+*   text:   3 numPoints numEdges, followed by "i j distance" for each edge
+*   binary: int 3, int numPoints, int numEdges, followed by int i, int j, double distance for each edge
+* The points are numbered from 0; the pairs which are not listed are infinitely far apart.
+* After reading, every edge has i < j and the edges are sorted by (i, j): self loops are
+* dropped, an edge listed twice keeps its smaller distance, and with Globals::rips_threshold >= 0
+* the edges longer than the threshold are dropped as well.
+********************************************************************/
+struct SparseEdgeList
+{
+	int numPoints = 0;
+	vector<pair<int, int>> edges;	// the endpoints of each edge
+	vector<double> lengths;			// the length of each edge
+
+	// the filtration values of the sparse Rips filtration: the points (value 0), followed by the edges
+	void filtrationValues(blitz::Array<double, 1> &arr) const
+	{
+		arr.resize(numPoints + edges.size());
+		for (int i = 0; i < numPoints; ++i)
+			arr(i) = 0.;
+		for (size_t e = 0; e < edges.size(); ++e)
+			arr(numPoints + e) = lengths[e];
+	}
+
+	// add the edge (i, j) as read from the file
+	void addEdge(int i, int j, double length)
+	{
+		if (i < 0 || j < 0 || i >= numPoints || j >= numPoints)
+		{
+			std::cerr << "The edge (" << i << ", " << j << ") has an endpoint outside of the " << numPoints << " points." << endl;
+			exit(EXIT_FAILURE);
+		}
+		if (i == j || (Globals::rips_threshold >= 0 && length > Globals::rips_threshold))
+			return;
+		if (i > j)
+			std::swap(i, j);
+		edges.push_back(std::make_pair(i, j));
+		lengths.push_back(length);
+	}
+
+	// sort the edges by their endpoints, and keep the shortest of the duplicated ones
+	void normalize()
+	{
+		vector<int> order(edges.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(), [this](int a, int b) {
+			return edges[a] < edges[b] || (edges[a] == edges[b] && lengths[a] < lengths[b]); });
+
+		vector<pair<int, int>> sortedEdges;
+		vector<double> sortedLengths;
+		for (int e : order)
+		{
+			if (!sortedEdges.empty() && sortedEdges.back() == edges[e])
+				continue;
+			sortedEdges.push_back(edges[e]);
+			sortedLengths.push_back(lengths[e]);
+		}
+		edges.swap(sortedEdges);
+		lengths.swap(sortedLengths);
+	}
+};
+
+
+struct RawDataReaderSparseRips
+{
+	void read(const string &file_name, SparseEdgeList &edgeList)
+	{
+		std::ifstream f(file_name.c_str(), std::ios::binary | std::ios::in);
+
+		int fileType, numPoints, numEdges;
+		f.read(reinterpret_cast<char*>(&fileType), sizeof(int));	 // read file type
+		f.read(reinterpret_cast<char*>(&numPoints), sizeof(int)); // read number of points
+		f.read(reinterpret_cast<char*>(&numEdges), sizeof(int));  // read number of edges
+
+		edgeList.numPoints = numPoints;
+		int i, j;
+		double length;
+		for (int e = 0; e < numEdges; ++e)
+		{
+			f.read(reinterpret_cast<char*>(&i), sizeof(int));
+			f.read(reinterpret_cast<char*>(&j), sizeof(int));
+			f.read(reinterpret_cast<char*>(&length), sizeof(double));
+			edgeList.addEdge(i, j, length);
+		}
+		edgeList.normalize();
+
+		f.close();
+	}
+};
+
+
+struct TextDataReaderSparseRips
+{
+	void read(const string &file_name, SparseEdgeList &edgeList)
+	{
+		std::ifstream f(file_name.c_str());
+
+		int fileType, numPoints, numEdges;
+		f >> fileType >> numPoints >> numEdges;
+
+		edgeList.numPoints = numPoints;
+		int i, j;
+		double length;
+		for (int e = 0; e < numEdges; ++e)
+		{
+			f >> i >> j >> length;
+			edgeList.addEdge(i, j, length);
+		}
+		edgeList.normalize();
+
+		f.close();
+	}
+};
+
+#endif // !DATA_READER_SPARSE_RIPS_H
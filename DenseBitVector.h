@@ -0,0 +1,74 @@
+#ifndef DENSE_BIT_VECTOR_H
+#define DENSE_BIT_VECTOR_H
+
+#include <vector>
+#include <cstdint>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+/********************************************************************
+* A dense bit vector over column (cell) indices, used as the working column when a
+* chain is reduced against the columns of a reduced boundary matrix.
+* The bits are packed into 64-bit words. A second level of summary bits marks the words
+* that may be nonzero, so finding the highest set bit (the pivot) only touches the dirty
+* words. The vector is meant to be reused: once a chain is reduced to zero, it is clean
+* again and can take the next chain without reallocation.
+********************************************************************/
+class DenseBitVector
+{
+public:
+	DenseBitVector(int size)
+		: mWords(((size + 63) >> 6) + 1, 0), mSummary(((mWords.size() + 63) >> 6) + 1, 0)
+	{
+	}
+
+	void flip(int idx)
+	{
+		int w = idx >> 6;
+		mWords[w] ^= uint64_t(1) << (idx & 63);
+		mSummary[w >> 6] |= uint64_t(1) << (w & 63);
+	}
+
+	// xor a sparse column into the vector
+	void flip(const std::vector<int> & column)
+	{
+		for (const auto & idx : column)
+			flip(idx);
+	}
+
+	// the highest set bit, or -1 if the vector is zero
+	int highestBit()
+	{
+		for (int s = mSummary.size() - 1; s >= 0; --s)
+		{
+			while (mSummary[s] != 0)
+			{
+				int w = (s << 6) + highestBitOfWord(mSummary[s]);
+				if (mWords[w] != 0)
+					return (w << 6) + highestBitOfWord(mWords[w]);
+
+				mSummary[s] &= ~(uint64_t(1) << (w & 63)); // the word became zero, it is no longer dirty
+			}
+		}
+		return -1;
+	}
+
+private:
+	static int highestBitOfWord(uint64_t word) // word must not be zero
+	{
+#if defined(_MSC_VER)
+		unsigned long idx;
+		_BitScanReverse64(&idx, word);
+		return idx;
+#else
+		return 63 - __builtin_clzll(word);
+#endif
+	}
+
+	std::vector<uint64_t> mWords;		// the bits
+	std::vector<uint64_t> mSummary;		// bit w is set if mWords[w] may be nonzero
+};
+
+#endif // !DENSE_BIT_VECTOR_H
@@ -2,12 +2,28 @@
 #define ABSTRACT_FILTRATION_H
 
 
-template<int dim, int arrayDim, int vertexDim>
+// The vertex list of a filtration whose values are indexed by the vertex number itself (arrayDim = vertexDim = 1):
+// vertex v is just v, so the list only records its size instead of storing the vertices
+struct IndexVertexList
+{
+	typedef blitz::TinyVector<int, 1> value_type;
+
+	size_t count = 0;
+
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+	value_type operator[](size_t v) const { return value_type((int)v); }
+};
+
+
+template<int dim, int arrayDim, int vertexDim, typename VertexListT = std::vector<blitz::TinyVector<int, vertexDim>>>
 class AbstractFiltration
 {
 public:
+	typedef VertexListT VertexList;
+
 	// initialize the vertex list, which will be used for indexing birth time and death time
-	virtual void init(std::vector<blitz::TinyVector<int, vertexDim>> *vList) = 0; 
+	virtual void init(VertexList *vList) = 0;
 
 	// return the number of cells in dimension d
 	virtual int getSizeInDim(int d) = 0;
@@ -16,9 +32,15 @@ public:
 	// and the cellToVertex list, which records the mapping from each cell to the component vertices
 	virtual void initList(std::vector<int> *birth_list, vector<MatrixListType> *cell2v_list, int d, bool verbose) = 0;
 
-	// compute the d-dimensional boundary matrix 
+	// compute the d-dimensional boundary matrix
 	virtual void calculateBoundaries(vector<MatrixListType> *boundary, int d, const vector<bool> & will_be_cleared) = 0;
+
+	// the factor within which the persistence diagram approximates the exact one (1: exact)
+	virtual double approximationFactor() const { return 1.; }
+
+	// whether the shortest cycles of the complex are the shortest ones of the filtration (false if the complex was
+	// made smaller first), i.e., whether the cycles of the optimal cycle search may be reported as optimal
+	virtual bool hasOptimalCycles() const { return true; }
 };
 
 #endif // !ABSTRACT_FILTRATION_H
-
@@ -0,0 +1,361 @@
+#ifndef ALPHA_FILTRATION_H
+#define ALPHA_FILTRATION_H
+
+#include "AbstractFiltration.h"
+#include "DelaunayTriangulation.h"
+#include "InputFileInfo.h"
+#include "DataReaders/DataReaderPointCloud.h"
+
+/********************************************************************
+* Alpha filtration of a point cloud in dimension maxDim = 2 or 3 (Edelsbrunner and Mucke, "Three-
+* dimensional alpha shapes"): the simplices of the Delaunay triangulation of the points (see
+* DelaunayTriangulation), each appearing at the smallest radius r such that it belongs to the
+* alpha complex, the subcomplex of the union of the balls of radius r around the points.
+* It has the homotopy type of that union, and so the persistence diagram of the Cech filtration
+* (with radii instead of the diameters of the Rips filtration), with O(n) simplices in 2D and
+* usually close to that in 3D, instead of the O(n^3) triangles of the Rips filtration.
+* The value of a simplex is the radius of its smallest circumsphere, unless it is attached: a
+* vertex of one of its cofacets lies inside that sphere. An attached simplex appears with its
+* first cofacet. The values are computed from the top dimension down.
+* A point equal to an earlier one is joined to it by an edge of value 0.
+* The filtration reads the input file itself and fills the values array passed to it: entry
+* p < n is the point p, then come the entries of the edges, of the triangles and, in 3D, of the
+* tetrahedra. These entries serve as the vertex list (IndexVertexList), so a cell is born at
+* its own entry, and the cycles are given by their point indices.
+* The simplices of each dimension are kept as a sorted list of their vertices, and a cell is
+* addressed by its position in that list.
+********************************************************************/
+template<int maxDim>
+class AlphaFiltration : public AbstractFiltration<maxDim, 1, 1, IndexVertexList> // arrayDim = 1 for the values of the simplices; vertexDim = 1 for 1D index
+{
+	typedef std::array<int, maxDim + 1> Cell; // the vertices of a simplex in increasing order, followed by zeros
+
+public:
+	// constructor
+	AlphaFiltration(blitz::Array<double, 1> *const p, const InputFileInfo &info) : mValues(p)
+	{
+		readPoints(info);
+		buildComplex();
+		computeValues(p);
+
+		if (info.verbose)
+		{
+			cout << "Alpha filtration of " << mCloud.numPoints << " points" << endl;
+			for (int d = 1; d <= maxDim; ++d)
+				cout << "Number of " << d << "-simplices: " << mCells[d].size() << endl;
+		}
+	}
+
+	// initialize the vertex list, which will be used for indexing birth time and death time
+	void init(IndexVertexList *vList)
+	{
+		vList->count = mValues->extent(0);
+	}
+
+	// return the number of cells in dimension d
+	int getSizeInDim(int d)
+	{
+		return mCells[d].size();
+	}
+
+	// initialize the birth list, which records the birth time for each cell;
+	// and the cellToVertex list, which records the mapping from each cell to the component vertices
+	void initList(std::vector<int> *birth_list, vector<MatrixListType> *cell2v_list, int d, bool =false)
+	{
+		int cellNum = getSizeInDim(d);
+
+		vector<std::pair<double, int>> order = sortedCells(d);
+
+		// gather the birth time and the vertices of each cell in the filtration order,
+		// and keep the order for calculateBoundaries
+		birth_list->resize(cellNum);
+		cell2v_list->resize(cellNum);
+		mOrder[d].resize(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			for (int k = begin; k < end; ++k)
+			{
+				int i = order[k].second;
+				mOrder[d][k] = i;
+				(*birth_list)[k] = mOffsets[d] + i;
+				(*cell2v_list)[k].assign(mCells[d][i].begin(), mCells[d][i].begin() + d + 1);
+			}
+		});
+	}
+
+	// compute the d-dimensional boundary matrix
+	void calculateBoundaries(vector<MatrixListType> *boundary, int d, const vector<bool> &)
+	{
+		int cellNum = getSizeInDim(d);
+
+		// the position of each (d-1)-simplex in the filtration order, which initList has computed
+		const vector<int> & subcomplexOrder = mOrder[d - 1];
+		vector<int> position(subcomplexOrder.size());
+		for (int k = 0; k < subcomplexOrder.size(); ++k)
+		{
+			position[subcomplexOrder[k]] = k;
+		}
+
+		// build the columns directly in the filtration order of the d-simplices, in parallel
+		boundary->resize(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			for (int k = begin; k < end; ++k)
+			{
+				const Cell & cell = mCells[d][mOrder[d][k]];
+
+				MatrixListType & column = (*boundary)[k];
+				for (int skip = 0; skip <= d; ++skip)
+					column.push_back(position[findCell(d - 1, facet(cell, d, skip))]);
+				mysort(column);
+			}
+		});
+	}
+
+private:
+	// read the point cloud
+	void readPoints(const InputFileInfo &info)
+	{
+		if (info.binary)
+		{
+			RawDataReaderPointCloud reader;
+			reader.read(info.input_path, mCloud);
+		}
+		else
+		{
+			TextDataReaderPointCloud reader;
+			reader.read(info.input_path, mCloud);
+		}
+
+		if (mCloud.dimPoints != maxDim)
+		{
+			std::cerr << "Error: the alpha filtration of points of dimension " << mCloud.dimPoints << " is not supported." << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// the simplices of the Delaunay triangulation and all their faces, and the edges of the duplicate points
+	void buildComplex()
+	{
+		DelaunayTriangulation<maxDim> delaunay;
+		if (!delaunay.triangulate(mCloud.coords, mCloud.numPoints))
+		{
+			std::cerr << "Error: the points of the alpha filtration must not lie in a hyperplane." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		mCells.assign(maxDim + 1, vector<Cell>());
+		mOrder.assign(maxDim + 1, vector<int>());
+		mCells[maxDim] = delaunay.simplices();
+		std::sort(mCells[maxDim].begin(), mCells[maxDim].end());
+
+		for (int d = maxDim - 1; d >= 1; --d)
+		{
+			vector<Cell> & cells = mCells[d];
+			for (const Cell & cell : mCells[d + 1])
+				for (int skip = 0; skip <= d + 1; ++skip)
+					cells.push_back(facet(cell, d + 1, skip));
+
+			if (d == 1)
+			{
+				for (const pair<int, int> & dup : delaunay.duplicates())
+				{
+					Cell edge = Cell();
+					edge[0] = std::min(dup.first, dup.second);
+					edge[1] = std::max(dup.first, dup.second);
+					cells.push_back(edge);
+				}
+			}
+
+			parallelSort(cells.begin(), cells.end());
+			cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+		}
+
+		// the duplicate points are not in the triangulation
+		mCells[0].assign(mCloud.numPoints, Cell());
+		for (int i = 0; i < mCloud.numPoints; ++i)
+			mCells[0][i][0] = i;
+	}
+
+	// fill the values: 0 for the points, then the alpha value of each simplex, from the top dimension down
+	void computeValues(blitz::Array<double, 1> *values)
+	{
+		mOffsets.assign(maxDim + 1, 0);
+		size_t total = mCloud.numPoints;
+		for (int d = 1; d <= maxDim; ++d)
+		{
+			mOffsets[d] = total;
+			total += mCells[d].size();
+		}
+		values->resize(total);
+		(*values) = 0.;
+
+		// the smallest value of the cofacets of each simplex, and whether one of them attaches it
+		vector<double> minCofacet;
+		vector<char> attached;
+		for (int d = maxDim; d >= 1; --d)
+		{
+			int cellNum = mCells[d].size();
+			minCofacet.resize(cellNum, std::numeric_limits<double>::infinity());
+			attached.resize(cellNum, 0);
+
+			// the value of each d-simplex, and the position of each of its facets, times 2, plus 1 if it attaches the facet
+			vector<int> facets(d > 1 ? (size_t)cellNum * (d + 1) : 0);
+			parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+				double center[maxDim];
+				for (int i = begin; i < end; ++i)
+				{
+					const Cell & cell = mCells[d][i];
+					(*values)(mOffsets[d] + i) = attached[i] ? minCofacet[i] : std::sqrt(smallestSphere(cell, d, center));
+
+					for (int skip = 0; skip <= d && d > 1; ++skip)
+					{
+						Cell face = facet(cell, d, skip);
+						double radius2 = smallestSphere(face, d - 1, center);
+						bool inside = squaredDistance(cell[skip], center) < radius2;
+						facets[(size_t)i * (d + 1) + skip] = 2 * findCell(d - 1, face) + (inside ? 1 : 0);
+					}
+				}
+			});
+
+			if (d == 1)
+				break;
+
+			int facetNum = mCells[d - 1].size();
+			minCofacet.assign(facetNum, std::numeric_limits<double>::infinity());
+			attached.assign(facetNum, 0);
+			for (int i = 0; i < cellNum; ++i)
+			{
+				double value = (*values)(mOffsets[d] + i);
+				for (int skip = 0; skip <= d; ++skip)
+				{
+					int code = facets[(size_t)i * (d + 1) + skip];
+					minCofacet[code / 2] = std::min(minCofacet[code / 2], value);
+					attached[code / 2] |= code % 2;
+				}
+			}
+		}
+	}
+
+	// the facet of the d-simplex without its vertex at position skip
+	static Cell facet(const Cell & cell, int d, int skip)
+	{
+		Cell face = Cell();
+		for (int k = 0, m = 0; k <= d; ++k)
+			if (k != skip)
+				face[m++] = cell[k];
+		return face;
+	}
+
+	// the position of the simplex among the simplices of dimension d
+	int findCell(int d, const Cell & cell) const
+	{
+		typename vector<Cell>::const_iterator it = std::lower_bound(mCells[d].begin(), mCells[d].end(), cell);
+		assert(it != mCells[d].end() && *it == cell);
+		return it - mCells[d].begin();
+	}
+
+	double coordinate(int p, int k) const
+	{
+		return mCloud.coords[(size_t)k * mCloud.numPoints + p];
+	}
+
+	double squaredDistance(int p, const double * center) const
+	{
+		double dist = 0.;
+		for (int k = 0; k < maxDim; ++k)
+			dist += (coordinate(p, k) - center[k]) * (coordinate(p, k) - center[k]);
+		return dist;
+	}
+
+	// the squared radius of the smallest sphere through the vertices of the d-simplex, whose center
+	// p0 + sum_i lambda_i (p_i - p0) solves 2 (p_i - p0) . (c - p0) = |p_i - p0|^2 for i = 1 .. d
+	double smallestSphere(const Cell & cell, int d, double * center) const
+	{
+		double u[maxDim][maxDim], a[maxDim][maxDim + 1]; // the edge vectors from p0, and the augmented system
+		for (int i = 0; i < d; ++i)
+			for (int k = 0; k < maxDim; ++k)
+				u[i][k] = coordinate(cell[i + 1], k) - coordinate(cell[0], k);
+		for (int i = 0; i < d; ++i)
+		{
+			a[i][d] = 0.;
+			for (int j = 0; j < d; ++j)
+				a[i][j] = 0.;
+			for (int k = 0; k < maxDim; ++k)
+			{
+				for (int j = 0; j < d; ++j)
+					a[i][j] += 2 * u[i][k] * u[j][k];
+				a[i][d] += u[i][k] * u[i][k];
+			}
+		}
+
+		// Gaussian elimination with partial pivoting; a zero pivot (coincident points) gets lambda 0
+		double lambda[maxDim];
+		for (int c = 0; c < d; ++c)
+		{
+			int pivot = c;
+			for (int r = c + 1; r < d; ++r)
+				if (std::fabs(a[r][c]) > std::fabs(a[pivot][c]))
+					pivot = r;
+			for (int j = 0; j <= d; ++j)
+				std::swap(a[c][j], a[pivot][j]);
+			if (a[c][c] == 0.)
+				continue;
+			for (int r = c + 1; r < d; ++r)
+			{
+				double f = a[r][c] / a[c][c];
+				for (int j = c; j <= d; ++j)
+					a[r][j] -= f * a[c][j];
+			}
+		}
+		for (int c = d - 1; c >= 0; --c)
+		{
+			lambda[c] = 0.;
+			if (a[c][c] == 0.)
+				continue;
+			double rhs = a[c][d];
+			for (int j = c + 1; j < d; ++j)
+				rhs -= a[c][j] * lambda[j];
+			lambda[c] = rhs / a[c][c];
+		}
+
+		double radius2 = 0.;
+		for (int k = 0; k < maxDim; ++k)
+		{
+			double offset = 0.;
+			for (int i = 0; i < d; ++i)
+				offset += lambda[i] * u[i][k];
+			center[k] = coordinate(cell[0], k) + offset;
+			radius2 += offset * offset;
+		}
+		return radius2;
+	}
+
+	// the d-simplices in the filtration order, as (value, position) keys sorted increasingly, ties broken by
+	// the position, i.e., by the vertices
+	vector<std::pair<double, int>> sortedCells(int d) const
+	{
+		int cellNum = mCells[d].size();
+		vector<std::pair<double, int>> order(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			for (int i = begin; i < end; ++i)
+				order[i] = std::make_pair((*mValues)(mOffsets[d] + i), i);
+		});
+
+		parallelSort(order.begin(), order.end());
+		return order;
+	}
+
+private:
+	PointCloud mCloud; // the points
+
+	vector<vector<Cell>> mCells; // the simplices of each dimension, sorted increasingly
+
+	vector<vector<int>> mOrder; // the positions in mCells of the simplices of each dimension, in the filtration order
+
+	vector<size_t> mOffsets; // the entry of the d-simplex i in the values is mOffsets[d] + i (the point itself for d = 0)
+
+	const blitz::Array<double, 1> * const mValues; // the values of the points and simplices
+
+	static const int BLOCK_SIZE = 4096; // the number of cells handled by one parallel task
+};
+
+#endif // !ALPHA_FILTRATION_H
@@ -0,0 +1,404 @@
+#ifndef DELAUNAY_TRIANGULATION_H
+#define DELAUNAY_TRIANGULATION_H
+
+#include <array>
+#include <vector>
+#include <random>
+#include <limits>
+#include <numeric>
+#include <cstdint>
+#include <algorithm>
+#include "GeometricPredicates.h"
+using namespace std;
+
+/********************************************************************
+* The Delaunay triangulation of points in dimension D = 2 or 3, computed by Bowyer-Watson
+* insertion with the exact predicates of GeometricPredicates, so that it is valid for any input,
+* including the degenerate ones (e.g., the cocircular points of a grid).
+* The triangulation is closed by ghost simplices: each facet of the convex hull is joined to
+* a vertex at infinity (INFINITE_VERTEX), so every simplex has D + 1 neighbors. All the simplices
+* are positively oriented (the ghosts once the infinite vertex is replaced by an inner point).
+* A point is inserted by walking from the last created simplex to one whose circumsphere
+* contains it, growing the cavity of all such simplices, and linking the point to its boundary.
+* The points are inserted in a biased randomized order (Amenta, Choi and Rote, "Incremental
+* constructions con BRIO"): rounds of doubling size, each sorted along a Z-order curve, so that
+* the walks are short and the expected running time stays close to linear.
+* A point equal to an earlier one is not inserted; it is reported as a duplicate of that one.
+********************************************************************/
+template<int D>
+class DelaunayTriangulation
+{
+public:
+	typedef std::array<int, D + 1> Simplex;
+
+	static const int INFINITE_VERTEX = -1;
+
+	// triangulate the numPoints points, whose coordinates are coords[k * numPoints + i] (coordinate-major,
+	// as in PointCloud); return false if they do not span the space (e.g., collinear points in 2D)
+	bool triangulate(const vector<double> & coords, int numPoints)
+	{
+		mNumPoints = numPoints;
+		mPoints.resize((size_t)numPoints * D);
+		for (int i = 0; i < numPoints; ++i)
+			for (int k = 0; k < D; ++k)
+				mPoints[(size_t)i * D + k] = coords[(size_t)k * numPoints + i];
+
+		mCells.clear();
+		mFreeCells.clear();
+		mDuplicates.clear();
+
+		vector<int> order = insertionOrder();
+		if (!createFirstSimplex(order))
+			return false;
+
+		for (int p : order)
+			insert(p);
+
+		return true;
+	}
+
+	// the finite D-simplices, with their vertices in increasing order
+	vector<Simplex> simplices() const
+	{
+		vector<Simplex> result;
+		for (const Cell & cell : mCells)
+		{
+			if (cell.alive && !isGhost(cell))
+			{
+				result.push_back(cell.v);
+				std::sort(result.back().begin(), result.back().end());
+			}
+		}
+		return result;
+	}
+
+	// the (duplicate, original) pairs of the points that were not inserted because they equal an earlier point
+	const vector<pair<int, int>> & duplicates() const
+	{
+		return mDuplicates;
+	}
+
+private:
+	struct Cell
+	{
+		Simplex v; // the vertices
+		Simplex neighbors; // neighbors[i] is the cell across the facet opposite v[i]
+		bool alive;
+	};
+
+	const double * point(int p) const
+	{
+		return mPoints.data() + (size_t)p * D;
+	}
+
+	static bool isGhost(const Cell & cell)
+	{
+		return std::find(cell.v.begin(), cell.v.end(), (int)INFINITE_VERTEX) != cell.v.end();
+	}
+
+	// the orientation of the finite points of p
+	static int orientation(const std::array<const double *, D + 1> & p)
+	{
+		if (D == 2)
+			return GeometricPredicates::orient2d(p[0], p[1], p[2]);
+		else
+			return GeometricPredicates::orient3d(p[0], p[1], p[2], p[3]);
+	}
+
+	// the orientation of the vertices of the cell, with v[i] replaced by the point q
+	int orientationWith(const Cell & cell, int i, const double * q) const
+	{
+		std::array<const double *, D + 1> p;
+		for (int k = 0; k <= D; ++k)
+			p[k] = (k == i) ? q : point(cell.v[k]);
+		return orientation(p);
+	}
+
+	// whether q lies strictly inside the circumsphere of the finite, positively oriented cell
+	bool inSphere(const Cell & cell, const double * q) const
+	{
+		if (D == 2)
+			return GeometricPredicates::incircle(point(cell.v[0]), point(cell.v[1]), point(cell.v[2]), q) > 0;
+		else
+			return GeometricPredicates::insphere(point(cell.v[0]), point(cell.v[1]), point(cell.v[2]), point(cell.v[3]), q) > 0;
+	}
+
+	// whether the cell is in conflict with q: q is in its circumsphere, or, for a ghost, strictly
+	// beyond its hull facet, or on the hyperplane of the facet and inside the facet's circumsphere
+	bool inConflict(const Cell & cell, const double * q) const
+	{
+		int i = std::find(cell.v.begin(), cell.v.end(), (int)INFINITE_VERTEX) - cell.v.begin();
+		if (i > D)
+			return inSphere(cell, q);
+
+		int o = orientationWith(cell, i, q);
+		return o > 0 || (o == 0 && inSphere(mCells[cell.neighbors[i]], q));
+	}
+
+	// the points shuffled, then split into rounds of doubling size, each sorted along a Z-order curve
+	vector<int> insertionOrder() const
+	{
+		vector<int> order(mNumPoints);
+		std::iota(order.begin(), order.end(), 0);
+		std::mt19937 generator(0);
+		std::shuffle(order.begin(), order.end(), generator);
+
+		// the Z-order code of each point, from its coordinates quantized in the bounding box
+		const int bits = 62 / D;
+		std::array<double, D> low, scale;
+		for (int k = 0; k < D; ++k)
+		{
+			low[k] = std::numeric_limits<double>::infinity();
+			double high = -low[k];
+			for (int p = 0; p < mNumPoints; ++p)
+			{
+				low[k] = std::min(low[k], point(p)[k]);
+				high = std::max(high, point(p)[k]);
+			}
+			scale[k] = (high > low[k]) ? (std::ldexp(1., bits) - 1) / (high - low[k]) : 0.;
+		}
+		vector<uint64_t> code(mNumPoints, 0);
+		for (int p = 0; p < mNumPoints; ++p)
+		{
+			for (int k = 0; k < D; ++k)
+			{
+				uint64_t c = (uint64_t)((point(p)[k] - low[k]) * scale[k]);
+				for (int b = 0; b < bits; ++b)
+					code[p] |= ((c >> b) & 1) << (b * D + k);
+			}
+		}
+
+		for (size_t begin = 0, end = std::min<size_t>(order.size(), 64); begin < order.size(); begin = end, end = std::min(order.size(), 2 * end))
+			std::sort(order.begin() + begin, order.begin() + end, [&code](int a, int b) {return code[a] < code[b];});
+		return order;
+	}
+
+	// build the first simplex from D + 1 affinely independent points, which are removed from the
+	// order, and its D + 1 ghosts; return false if there are no such points
+	bool createFirstSimplex(vector<int> & order)
+	{
+		Simplex first;
+		int found = 0;
+		for (size_t k = 0; k < order.size() && found <= D; ++k)
+		{
+			const double * q = point(order[k]);
+			bool independent;
+			if (found == 0)
+				independent = true;
+			else if (found == 1)
+				independent = !std::equal(q, q + D, point(first[0]));
+			else if (found == 2)
+			{
+				// not on the line of the first two points: one of the projections on the coordinate planes is not collinear
+				independent = false;
+				for (int a = 0; a < D && !independent; ++a)
+				{
+					int b = (a + 1) % D;
+					double p0[2] = { point(first[0])[a], point(first[0])[b] };
+					double p1[2] = { point(first[1])[a], point(first[1])[b] };
+					double p2[2] = { q[a], q[b] };
+					independent = GeometricPredicates::orient2d(p0, p1, p2) != 0;
+				}
+			}
+			else
+				independent = GeometricPredicates::orient3d(point(first[0]), point(first[1]), point(first[2]), q) != 0;
+
+			if (independent)
+			{
+				first[found++] = order[k];
+				order.erase(order.begin() + k);
+				k--;
+			}
+		}
+		if (found <= D)
+			return false;
+
+		std::array<const double *, D + 1> p;
+		for (int k = 0; k <= D; ++k)
+			p[k] = point(first[k]);
+		if (orientation(p) < 0)
+			std::swap(first[0], first[1]);
+
+		// each ghost replaces one vertex with the infinite one and swaps two others, so that it is
+		// oriented the other way: the infinite vertex lies beyond the facet
+		vector<int> created(1, newCell(first));
+		for (int i = 0; i <= D; ++i)
+		{
+			Simplex ghost = first;
+			ghost[i] = INFINITE_VERTEX;
+			std::swap(ghost[(i + 1) % (D + 1)], ghost[(i + 2) % (D + 1)]);
+			created.push_back(newCell(ghost));
+		}
+		linkCells(created, INFINITE_VERTEX - 1);
+		mLast = created[0];
+		return true;
+	}
+
+	int newCell(const Simplex & v)
+	{
+		int c;
+		if (mFreeCells.empty())
+		{
+			c = mCells.size();
+			mCells.push_back(Cell());
+			mVisited.push_back(0);
+		}
+		else
+		{
+			c = mFreeCells.back();
+			mFreeCells.pop_back();
+		}
+		mCells[c].v = v;
+		mCells[c].neighbors.fill(-1);
+		mCells[c].alive = true;
+		return c;
+	}
+
+	// set the neighbors of the cells across their shared facets, except the facets opposite the vertex skip
+	void linkCells(const vector<int> & cells, int skip)
+	{
+		mFacets.clear();
+		for (int c : cells)
+		{
+			for (int i = 0; i <= D; ++i)
+			{
+				if (mCells[c].v[i] == skip)
+					continue;
+				std::array<int, D> key;
+				for (int k = 0, m = 0; k <= D; ++k)
+					if (k != i)
+						key[m++] = mCells[c].v[k];
+				std::sort(key.begin(), key.end());
+				mFacets.push_back(std::make_pair(key, std::make_pair(c, i)));
+			}
+		}
+		std::sort(mFacets.begin(), mFacets.end());
+		for (size_t k = 0; k + 1 < mFacets.size(); k += 2)
+		{
+			pair<int, int> a = mFacets[k].second, b = mFacets[k + 1].second;
+			mCells[a.first].neighbors[a.second] = b.first;
+			mCells[b.first].neighbors[b.second] = a.first;
+		}
+	}
+
+	// a cell in conflict with the point p (found by walking from the last created cell), or -1 if p
+	// equals a vertex of the triangulation
+	int locate(int p)
+	{
+		const double * q = point(p);
+		int c = mLast;
+		if (isGhost(mCells[c]))
+		{
+			int i = std::find(mCells[c].v.begin(), mCells[c].v.end(), (int)INFINITE_VERTEX) - mCells[c].v.begin();
+			c = mCells[c].neighbors[i];
+		}
+
+		// move across a facet that separates the cell from p, starting from a random facet so that
+		// the walk does not cycle; a ghost is only entered when p lies beyond its hull facet
+		while (!isGhost(mCells[c]))
+		{
+			int start = mRandom() % (D + 1), next = -1;
+			for (int k = 0; k <= D && next < 0; ++k)
+			{
+				int i = (start + k) % (D + 1);
+				if (orientationWith(mCells[c], i, q) < 0)
+					next = mCells[c].neighbors[i];
+			}
+			if (next < 0)
+				break;
+			c = next;
+		}
+
+		if (!isGhost(mCells[c]))
+		{
+			for (int v : mCells[c].v)
+			{
+				if (std::equal(q, q + D, point(v)))
+				{
+					mDuplicates.push_back(std::make_pair(p, v));
+					return -1;
+				}
+			}
+		}
+		return c;
+	}
+
+	// insert the point p: replace the cells in conflict with it by the cone from p over their boundary
+	void insert(int p)
+	{
+		int start = locate(p);
+		if (start < 0)
+			return;
+
+		const double * q = point(p);
+		mStamp += 2; // mVisited: mStamp for the cavity, mStamp + 1 for the cells tested outside of it
+		mCavity.assign(1, start);
+		mVisited[start] = mStamp;
+		mBoundary.clear();
+		for (size_t k = 0; k < mCavity.size(); ++k)
+		{
+			int c = mCavity[k];
+			for (int i = 0; i <= D; ++i)
+			{
+				int n = mCells[c].neighbors[i];
+				if (mVisited[n] == mStamp)
+					continue;
+				if (mVisited[n] != mStamp + 1 && inConflict(mCells[n], q))
+				{
+					mVisited[n] = mStamp;
+					mCavity.push_back(n);
+				}
+				else
+				{
+					mVisited[n] = mStamp + 1;
+					mBoundary.push_back(std::make_pair(c, i));
+				}
+			}
+		}
+
+		// the new cell of a boundary facet keeps the orientation of the cavity cell, with p in place of its vertex
+		mCreated.clear();
+		for (const pair<int, int> & facet : mBoundary)
+		{
+			Simplex v = mCells[facet.first].v;
+			v[facet.second] = p;
+			int c = newCell(v);
+			int outside = mCells[facet.first].neighbors[facet.second];
+			mCells[c].neighbors[facet.second] = outside;
+			*std::find(mCells[outside].neighbors.begin(), mCells[outside].neighbors.end(), facet.first) = c;
+			mCreated.push_back(c);
+		}
+		linkCells(mCreated, p);
+
+		for (int c : mCavity)
+		{
+			mCells[c].alive = false;
+			mFreeCells.push_back(c);
+		}
+		mLast = mCreated.back();
+	}
+
+private:
+	int mNumPoints = 0;
+
+	vector<double> mPoints; // the coordinates of the points, point by point
+
+	vector<Cell> mCells; // the cells, including the ghosts and the free ones
+
+	vector<int> mFreeCells; // the cells removed by the insertions, to be reused
+
+	vector<pair<int, int>> mDuplicates; // (duplicate, original) points
+
+	int mLast = 0; // the last created cell, from which the next walk starts
+
+	std::minstd_rand mRandom;
+
+	// the work space of the insertions
+	vector<unsigned int> mVisited; // the stamp of the last insertion that visited each cell
+	unsigned int mStamp = 0;
+	vector<int> mCavity, mCreated;
+	vector<pair<int, int>> mBoundary; // (cavity cell, facet) on the boundary of the cavity
+	vector<pair<std::array<int, D>, pair<int, int>>> mFacets; // (sorted vertices, (cell, facet)) of the new cells
+};
+
+#endif // !DELAUNAY_TRIANGULATION_H
@@ -0,0 +1,155 @@
+#ifndef EDGE_COLLAPSE_H
+#define EDGE_COLLAPSE_H
+
+#include <vector>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+using namespace std;
+
+/********************************************************************
+* Filtered strong edge collapse of a flag filtration given by its 1-skeleton (Boissonnat and
+* Pritam, "Edge collapse and persistence of flag complexes").
+* An edge e = (u, v) is dominated by a vertex w if w is adjacent to u, v and to all of their
+* common neighbors N(e). Its link is then a cone, so the flag complex collapses onto the flag
+* complex of the graph without e. An edge that stays dominated at every value from its own on
+* can be removed from the whole filtration without changing the persistence diagram.
+* The edges are examined from the biggest value down, each one against the graph from which
+* the edges already removed are gone. Along the filtration, N(e) only grows. Between two growths,
+* a vertex that dominates e keeps dominating it. So the domination is only tested at the values
+* where a common neighbor appears, and the previous dominator is tried first.
+********************************************************************/
+class EdgeCollapser
+{
+public:
+	// the graph on numPoints points, whose edge k is edges[k] (i < j) with the value values[k]
+	EdgeCollapser(int numPoints, const vector<pair<int, int>> & edges, const vector<double> & values)
+		: mEdges(edges), mValues(values)
+	{
+		// the neighbors of each point, sorted by index, with the edge leading to them
+		mOffsets.assign(numPoints + 1, 0);
+		for (const auto & e : mEdges)
+		{
+			mOffsets[e.first + 1]++;
+			mOffsets[e.second + 1]++;
+		}
+		for (int i = 0; i < numPoints; ++i)
+			mOffsets[i + 1] += mOffsets[i];
+
+		mNeighbors.resize(mOffsets[numPoints]);
+		vector<int> fill(mOffsets.begin(), mOffsets.end() - 1);
+		for (int k = 0; k < mEdges.size(); ++k)
+		{
+			mNeighbors[fill[mEdges[k].first]++] = std::make_pair(mEdges[k].second, k);
+			mNeighbors[fill[mEdges[k].second]++] = std::make_pair(mEdges[k].first, k);
+		}
+		for (int i = 0; i < numPoints; ++i)
+			std::sort(mNeighbors.begin() + mOffsets[i], mNeighbors.begin() + mOffsets[i + 1]);
+	}
+
+	// collapse the dominated edges; return for each edge whether it is kept
+	vector<char> collapse()
+	{
+		vector<int> order(mEdges.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(),
+			[this](int a, int b) {return mValues[a] > mValues[b] || (mValues[a] == mValues[b] && a > b);});
+
+		mKept.assign(mEdges.size(), 1);
+		for (int e : order)
+		{
+			if (isDominated(e))
+				mKept[e] = 0;
+		}
+		return mKept;
+	}
+
+private:
+	// the value of the edge (a, b), infinite if it is not in the graph
+	double value(int a, int b) const
+	{
+		vector<pair<int, int>>::const_iterator first = mNeighbors.begin() + mOffsets[a], last = mNeighbors.begin() + mOffsets[a + 1];
+		vector<pair<int, int>>::const_iterator it = std::lower_bound(first, last, std::make_pair(b, 0));
+		return (it != last && it->first == b && mKept[it->second]) ? mValues[it->second] : std::numeric_limits<double>::infinity();
+	}
+
+	// whether w is adjacent, at value t, to the common neighbors mJoins[begin .. end - 1]
+	bool dominates(int w, size_t begin, size_t end, double t) const
+	{
+		for (size_t k = begin; k < end; ++k)
+		{
+			if (mJoins[k].second != w && value(w, mJoins[k].second) > t)
+				return false;
+		}
+		return true;
+	}
+
+	// whether edge e is dominated at every value from its own on
+	bool isDominated(int e)
+	{
+		int u = mEdges[e].first, v = mEdges[e].second;
+		double t = mValues[e];
+
+		// the common neighbors of u and v, with the value at which they join N(e)
+		mJoins.clear();
+		vector<pair<int, int>>::const_iterator a = mNeighbors.begin() + mOffsets[u], aEnd = mNeighbors.begin() + mOffsets[u + 1];
+		vector<pair<int, int>>::const_iterator b = mNeighbors.begin() + mOffsets[v], bEnd = mNeighbors.begin() + mOffsets[v + 1];
+		while (a != aEnd && b != bEnd)
+		{
+			if (a->first < b->first)
+				a++;
+			else if (b->first < a->first)
+				b++;
+			else
+			{
+				if (mKept[a->second] && mKept[b->second])
+					mJoins.push_back(std::make_pair(std::max(t, std::max(mValues[a->second], mValues[b->second])), a->first));
+				a++;
+				b++;
+			}
+		}
+		std::sort(mJoins.begin(), mJoins.end());
+
+		if (mJoins.empty() || mJoins[0].first > t)
+			return false; // no common neighbor when e appears
+
+		int dominator = -1;
+		size_t joined = 0;
+		while (joined < mJoins.size())
+		{
+			size_t first = joined;
+			t = mJoins[first].first;
+			while (joined < mJoins.size() && mJoins[joined].first == t)
+				joined++;
+
+			// the previous dominator only has to be adjacent to the new common neighbors
+			if (dominator >= 0 && dominates(dominator, first, joined, t))
+				continue;
+
+			dominator = -1;
+			for (size_t c = 0; c < joined && dominator < 0; ++c)
+			{
+				if (dominates(mJoins[c].second, 0, joined, t))
+					dominator = mJoins[c].second;
+			}
+			if (dominator < 0)
+				return false;
+		}
+		return true;
+	}
+
+private:
+	const vector<pair<int, int>> & mEdges; // the endpoints of each edge
+
+	const vector<double> & mValues; // the value of each edge
+
+	vector<int> mOffsets; // the neighbors of point i are mNeighbors[mOffsets[i] .. mOffsets[i + 1] - 1]
+
+	vector<pair<int, int>> mNeighbors; // (neighbor, edge) pairs
+
+	vector<char> mKept; // whether each edge is still in the graph
+
+	vector<pair<double, int>> mJoins; // the common neighbors of the examined edge, with the value at which they join
+};
+
+#endif // !EDGE_COLLAPSE_H
@@ -1,250 +1,331 @@
 #ifndef FULL_RIPS_FILTRATION_H
 #define FULL_RIPS_FILTRATION_H
 
+#include <cmath>
 #include "AbstractFiltration.h"
+#include "SimplexIndexing.h"
+#include "EdgeCollapse.h"
 #include "InputFileInfo.h"
+#include "ThreadPool.h"
+#include "DataReaders/DataReaderFullRips.h"
+
+/********************************************************************
+* The vertex list of FullRipsFiltration: vertex v is the packed entry v (see IndexVertexList).
+* In the output files, the entry of an edge is written as its pair of points (i, j), i < j,
+* and the entry of a point p as (0, p), like the explicit list of pairs used to be.
+********************************************************************/
+struct RipsVertexList : IndexVertexList
+{
+	typedef blitz::TinyVector<int, 2> pair_type;
+
+	int numPoints = 0;
+
+	// given an index into the packed distances (at least numPoints), convert it to the pair of points;
+	// the pairs (i, .) start at numPoints + packedIndex(i, i + 1, n), so i is the solution of a quadratic,
+	// corrected for the rounding of the square root
+	std::pair<int, int> computePairIndex(int idx) const
+	{
+		long long k = (long long)idx - numPoints;
+		long long n = numPoints;
+		long long row = (long long)((2 * n - 1 - std::sqrt((double)((2 * n - 1) * (2 * n - 1) - 8 * k))) / 2);
+		while (row > 0 && packedIndex(row, row + 1, numPoints) > k)
+			row--;
+		while (row + 1 < n - 1 && packedIndex(row + 1, row + 2, numPoints) <= k)
+			row++;
+
+		int col = (int)(k - packedIndex(row, row + 1, numPoints)) + row + 1;
+		return std::make_pair((int)row, col);
+	}
+};
 
+// the vertex written to the output files for the packed entry v (see outputVertex)
+inline RipsVertexList::pair_type outputVertex(const RipsVertexList & vList, const blitz::TinyVector<int, 1> & v)
+{
+	if (v[0] < vList.numPoints)
+		return RipsVertexList::pair_type(0, v[0]);
+
+	std::pair<int, int> points = vList.computePairIndex(v[0]);
+	return RipsVertexList::pair_type(points.first, points.second);
+}
+
+
+/********************************************************************
+* Rips filtration of a point set given by its distance matrix, truncated at a maximal
+* diameter: only the simplices whose diameter is at most mThreshold are built. By default
+* the threshold is the enclosing radius (the smallest radius r such that some point is
+* within distance r of all others); beyond it the complex is a cone, so no homology class
+* survives it and the truncation does not change the persistence diagram. Below the enclosing
+* radius, the classes still alive at the threshold are saved as dying at infinity.
+* A simplex is identified by its 64-bit combinatorial key (see SimplexIndexing); the existing
+* simplices of each dimension are kept as a sorted list of these keys, and a cell is addressed
+* by its position in that list.
+* The distances are stored packed, in the 1D layout of the sparse inputs (see DataReaderFullRips):
+* entry p < n is the point p, and entry n + packedIndex(i, j, n) carries d(i, j). These entries
+* serve as the vertex list (RipsVertexList), so a cell is born at the entry of its longest edge
+* (of its point for the vertices), and the cycles are given by their point indices.
+* Optionally (Globals::edge_collapse), the dominated edges are collapsed before the simplices are
+* built. The diagram is the same, but the cycles are then computed within the smaller complex, so
+* they are not reported as optimal.
+********************************************************************/
 template<int maxDim>
-class FullRipsFiltration : public AbstractFiltration<maxDim, 2, 2> // arrayDim = 2 for 2D distance matrix; vertexDim = 2 for 2D point index
+class FullRipsFiltration : public AbstractFiltration<maxDim, 1, 1, RipsVertexList> // arrayDim = 1 for the packed distances; vertexDim = 1 for 1D index
 {
-	typedef blitz::TinyVector<int, 2> matrixIdx;
+	typedef typename SimplexIndexing<maxDim>::SimplexKey SimplexKey;
 
 public:
 	// constructor
-	FullRipsFiltration(const blitz::Array<double, 2> *const p, const InputFileInfo &info) : mDistanceMatrix(p)
+	FullRipsFiltration(const blitz::Array<double, 1> *const p, const InputFileInfo &info) : mDistances(p)
 	{
-		mPointsNum = p->extent(1);
-
-		precomputeBinomials();
-		precomputeCellNums();
+		mPointsNum = info.numPoints;
+		double enclosingRadius = computeEnclosingRadius();
+		mThreshold = (Globals::rips_threshold < 0) ? enclosingRadius : Globals::rips_threshold;
+		if (mThreshold < enclosingRadius)
+			cout << "Warning: the Rips threshold " << mThreshold << " is below the enclosing radius " << enclosingRadius
+				<< "; the classes alive at the threshold never die" << endl;
+		if (info.verbose)
+			cout << "Rips filtration truncated at diameter " << mThreshold << endl;
+
+		mIndexing.init(mPointsNum);
+		enumerateSimplices(info.verbose);
 	}
 
 	// initialize the vertex list, which will be used for indexing birth time and death time
-	void init(std::vector<matrixIdx> *vList)
+	void init(RipsVertexList *vList)
 	{
-		if (!vList->empty())
-			return;
-
-		matrixIdx idx;
-		for (int i = 0; i < mPointsNum; ++i)
-		{
-			for (int j = i ; j < mPointsNum;++j)
-			{
-				idx = i, j;
-				vList->push_back(idx);
-			}
-		}
+		vList->count = mDistances->extent(0);
+		vList->numPoints = mPointsNum;
 	}
 
 	// return the number of cells in dimension d
 	int getSizeInDim(int d)
 	{
-		return mBreakPoints[d + 1] - mBreakPoints[d];
+		return mSimplices[d].size();
 	}
 
 	// initialize the birth list, which records the birth time for each cell;
 	// and the cellToVertex list, which records the mapping from each cell to the component vertices
 	void initList(std::vector<int> *birth_list, vector<MatrixListType> *cell2v_list, int d, bool verbose=false)
 	{
-		typedef std::tuple<int, double, int, vector<int>> elemType;
-
 		int cellNum = getSizeInDim(d);
-		birth_list->resize(cellNum);
-		birth_list->clear();
 
-		vector<int> pointsIdxVector;
-		vector<elemType> birthVector;
-		double diameter;
-		int matrixIntIdx;
-		std::pair<int, int> idxPair;
+		vector<int> births(cellNum);
+		vector<std::pair<double, int>> order = sortedCells(d, births);
 
-		// compute the birth time index (integer) for each complex cell
-		for (int i = mBreakPoints[d]; i < mBreakPoints[d+1]; ++i)
-		{
-			conversion(i, pointsIdxVector);
-			diameter = getDiameter(pointsIdxVector.begin(), pointsIdxVector.end(), idxPair);
-			matrixIntIdx = computeIntIndex(idxPair);
-			std::sort(pointsIdxVector.begin(), pointsIdxVector.end()); // need to sort it in ascending order for future use
-
-			birthVector.push_back(std::make_tuple(i, diameter, matrixIntIdx, pointsIdxVector));
-		}
-
-		// sort the cells in nondecreasing order
-		std::sort(birthVector.begin(), birthVector.end(),
-			[](elemType const & a, elemType const & b) {return std::get<1>(a) < std::get<1>(b);});
-
-		// copy the birth time
-		std::transform(birthVector.begin(), birthVector.end(), std::back_inserter(*birth_list),
-			[](elemType const & a) {return std::get<2>(a);});
+		// gather the birth time and the vertices of each cell in the filtration order,
+		// and keep the order for calculateBoundaries
+		birth_list->resize(cellNum);
+		cell2v_list->resize(cellNum);
+		mOrder[d].resize(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			for (int k = begin; k < end; ++k)
+			{
+				int i = order[k].second;
+				mOrder[d][k] = i;
+				(*birth_list)[k] = births[i];
 
-		// compute the cell_ to_vertices list
-		std::transform(birthVector.begin(), birthVector.end(), std::back_inserter(*cell2v_list),
-			[](elemType const & a) {return std::get<3>(a);});
+				MatrixListType & points = (*cell2v_list)[k];
+				mIndexing.conversion(d, mSimplices[d][i], points);
+				std::reverse(points.begin(), points.end()); // need to sort it in ascending order for future use
+			}
+		});
 	}
 
 	// compute the d-dimensional boundary matrix 
 	void calculateBoundaries(vector<MatrixListType> *boundary, int d, const vector<bool> & will_be_cleared)
 	{
-		typedef std::tuple<int, double, vector<int>> elemType;
-
 		int cellNum = getSizeInDim(d);
-		boundary->resize(cellNum);
-		boundary->clear();
-
-		vector<int> pointsIdxVector, subComplexIdxVector;
-		vector<elemType> birthVector;
-		vector<pair<int, double>> subcomplexVector;
-		double diameter;
-		int subComplexIdx;
-		std::pair<int, int> idxPair;
-
-		// first, list the subcomplex of dimension d-1
-		for (int i = mBreakPoints[d-1]; i < mBreakPoints[d]; ++i)
-		{
-			conversion(i, pointsIdxVector);
-			diameter = getDiameter(pointsIdxVector.begin(), pointsIdxVector.end());
-			subcomplexVector.push_back(std::make_pair(i, diameter));
-		}
 
-		// sort
-		std::sort(subcomplexVector.begin(), subcomplexVector.end(),
-			[](pair<int, double> const & a, pair<int, double> const &b) {return a.second < b.second;});
-
-		// create mapping
-		std::map<int, int> map2order;
-		for (int i = 0; i< subcomplexVector.size(); ++i)
+		// the position of each (d-1)-simplex in the filtration order, which initList has computed
+		const vector<int> & subcomplexOrder = mOrder[d - 1];
+		vector<int> position(subcomplexOrder.size());
+		for (int k = 0; k < subcomplexOrder.size(); ++k)
 		{
-			map2order[subcomplexVector[i].first] = i;
+			position[subcomplexOrder[k]] = k;
 		}
-		
-
-		for (int i = mBreakPoints[d]; i < mBreakPoints[d + 1]; ++i)
-		{
-			conversion(i, pointsIdxVector);
-			diameter = getDiameter(pointsIdxVector.begin(), pointsIdxVector.end(), idxPair);
-			subComplexIdxVector.clear();
 
-			for (vector<int>::const_iterator skip = pointsIdxVector.begin(); skip != pointsIdxVector.end(); skip++)
+		// build the columns directly in the filtration order of the d-simplices, in parallel
+		boundary->resize(cellNum);
+		vector<vector<int>> buffers(getThreadPool().size());
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int worker) {
+			vector<int> & pointsIdxVector = buffers[worker];
+			for (int k = begin; k < end; ++k)
 			{
-				subComplexIdx = conversion_with_skip<vector<int>::const_iterator>(pointsIdxVector.begin(), pointsIdxVector.end(), skip);
-				subComplexIdxVector.push_back(map2order[subComplexIdx]);
-			}
-
-			birthVector.push_back(std::make_tuple(i, diameter, subComplexIdxVector));
-		}
+				mIndexing.conversion(d, mSimplices[d][mOrder[d][k]], pointsIdxVector);
 
-		std::sort(birthVector.begin(), birthVector.end(),
-			[](elemType const & a, elemType const & b) {return std::get<1>(a) < std::get<1>(b);});
-
-		std::transform(birthVector.begin(), birthVector.end(), std::back_inserter(*boundary),
-			[](elemType const & a) {return std::get<2>(a);});
+				MatrixListType & column = (*boundary)[k];
+				for (vector<int>::const_iterator skip = pointsIdxVector.begin(); skip != pointsIdxVector.end(); skip++)
+					column.push_back(position[findSimplex(d - 1, mIndexing.conversion_with_skip(pointsIdxVector.cbegin(), pointsIdxVector.cend(), skip))]);
+				mysort(column);
+			}
+		});
+	}
 
-		for (std::vector<MatrixListType>::iterator it = boundary->begin(), end = boundary->end(); it != end; ++it)
-			mysort(*it);
+	// the cycles of a collapsed complex are not proven optimal
+	bool hasOptimalCycles() const
+	{
+		return !Globals::edge_collapse;
 	}
 
 private:
-	// precompute the number of cells for each dimension
-	void precomputeCellNums()
+	// the distance between the points i and j
+	double distance(int i, int j) const
 	{
-		mBreakPoints.push_back(0);
-		for (int i = 1; i <= maxDim + 1; ++i)
-		{
-			mBreakPoints.push_back(mBreakPoints[i - 1] + mBinomials[mPointsNum][i]);
-		}
+		return (i == j) ? 0. : (*mDistances)(computeIntIndex(std::make_pair(i, j)));
 	}
 
-	// precompute the binomials
-	void precomputeBinomials()
+	// the smallest radius r such that some point is within distance r of all the other points;
+	// each packed distance is visited once and counted for both of its points
+	double computeEnclosingRadius() const
 	{
-		for (int i = 0; i <= mPointsNum; ++i)
+		if (mPointsNum == 0)
+			return 0.;
+
+		vector<double> eccentricity(mPointsNum, 0.);
+		int idx = mPointsNum;
+		for (int i = 0; i < mPointsNum; ++i)
 		{
-			vector<int> binomRow;
-			for (int j = 0; j <= maxDim + 1; ++j)
+			for (int j = i + 1; j < mPointsNum; ++j, ++idx)
 			{
-				binomRow.push_back(binom(i, j)); // compute C(i, j)
+				double dist = (*mDistances)(idx);
+				eccentricity[i] = std::max(eccentricity[i], dist);
+				eccentricity[j] = std::max(eccentricity[j], dist);
 			}
-			mBinomials.push_back(binomRow);
 		}
+		return *std::min_element(eccentricity.begin(), eccentricity.end());
 	}
 
-	// compute binomial C(n, k)
-	int binom(int n, int k) const
+	// enumerate the simplices of diameter at most mThreshold, i.e., the cliques of the neighborhood graph,
+	// in each dimension by extending the simplices of the dimension below with a bigger neighbor.
+	// With Globals::edge_collapse, the dominated edges are first removed from the graph (see EdgeCollapser).
+	void enumerateSimplices(bool verbose)
 	{
-		if (n < k)
-			return 0;
-		
-		int result = 1;
-		for (int i = n - k + 1; i <= n; ++i) 
-		{
-			result *= i;
-		}
+		vector<vector<int>> neighbors(mPointsNum); // the neighbors with a bigger index within the threshold
+		int idx = mPointsNum;
+		for (int i = 0; i < mPointsNum; ++i)
+			for (int j = i + 1; j < mPointsNum; ++j, ++idx)
+				if ((*mDistances)(idx) <= mThreshold)
+					neighbors[i].push_back(j);
+
+		if (Globals::edge_collapse)
+			collapseEdges(neighbors, verbose);
 
-		for (int i = k; i >= 1; --i) 
+		mSimplices.assign(maxDim + 1, vector<SimplexKey>());
+		mOrder.assign(maxDim + 1, vector<int>());
+		for (int i = 0; i < mPointsNum; ++i)
+			mSimplices[0].push_back(i);
+
+		vector<int> pointsIdxVector;
+		for (int d = 1; d <= maxDim; ++d)
 		{
-			result /= i;
+			for (SimplexKey key : mSimplices[d - 1])
+			{
+				mIndexing.conversion(d - 1, key, pointsIdxVector); // pointsIdxVector[0] is the biggest vertex
+				for (int v : neighbors[pointsIdxVector[0]])
+				{
+					bool isClique = true;
+					for (size_t k = 1; k < pointsIdxVector.size() && isClique; ++k)
+					{
+						const vector<int> & others = neighbors[pointsIdxVector[k]];
+						isClique = Globals::edge_collapse ? std::binary_search(others.begin(), others.end(), v) : distance(pointsIdxVector[k], v) <= mThreshold;
+					}
+					if (isClique)
+						mSimplices[d].push_back(mIndexing.extend(key, d, v));
+				}
+			}
+			std::sort(mSimplices[d].begin(), mSimplices[d].end());
 		}
-
-		return result;
 	}
 
-	// given an index, return its corresponding dimension
-	int getLocalDim(int idx) const
+	// the d-simplices in the filtration order, as (diameter, position) keys sorted increasingly; ties are
+	// broken by the simplex key, so that the order of the cells does not depend on which other cells are
+	// truncated; births receives the birth index of each simplex (by position).
+	// Sorting these compact keys instead of the cells themselves avoids moving the vertex lists around.
+	vector<std::pair<double, int>> sortedCells(int d, vector<int> & births) const
 	{
-		int k = 0;
-		while (k < maxDim + 1 && mBreakPoints[k + 1] <= idx) 
-		{
-			k++;
-		}
+		int cellNum = mSimplices[d].size();
+		vector<std::pair<double, int>> order(cellNum);
+		vector<vector<int>> buffers(getThreadPool().size());
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int worker) {
+			vector<int> & pointsIdxVector = buffers[worker];
+			int birthIdx;
+			for (int i = begin; i < end; ++i)
+			{
+				mIndexing.conversion(d, mSimplices[d][i], pointsIdxVector);
+				order[i] = std::make_pair(getDiameter(pointsIdxVector.begin(), pointsIdxVector.end(), birthIdx), i);
+				births[i] = birthIdx;
+			}
+		});
 
-		return k;
+		parallelSort(order.begin(), order.end());
+		return order;
 	}
 
-	// index -> set of points (in decreasing index order)
-	void conversion(int idx, vector<int> & out)
+	// remove the dominated edges from the neighborhood graph
+	void collapseEdges(vector<vector<int>> & neighbors, bool verbose) const
 	{
-		out.clear();
+		vector<pair<int, int>> edges;
+		vector<double> lengths;
+		for (int i = 0; i < mPointsNum; ++i)
+		{
+			for (int j : neighbors[i])
+			{
+				edges.push_back(std::make_pair(i, j));
+				lengths.push_back(distance(i, j));
+			}
+		}
 
-		int k = getLocalDim(idx);
-		idx -= mBreakPoints[k];
-		int bcoeff = mPointsNum - 1;
+		EdgeCollapser collapser(mPointsNum, edges, lengths);
+		vector<char> kept = collapser.collapse();
 
-		for (; k >= 0; k--) 
+		size_t keptNum = 0;
+		for (int i = 0; i < mPointsNum; ++i)
+			neighbors[i].clear();
+		for (size_t k = 0; k < edges.size(); ++k)
 		{
-			while (mBinomials[bcoeff][k + 1] > idx)
+			if (kept[k])
 			{
-				bcoeff--;
+				neighbors[edges[k].first].push_back(edges[k].second);
+				keptNum++;
 			}
-			out.push_back(bcoeff);
-			idx -= mBinomials[bcoeff][k + 1];
-			bcoeff--;
 		}
+
+		if (verbose)
+			cout << "Edge collapse kept " << keptNum << " of " << edges.size() << " edges" << endl;
 	}
 
-	// given a complex, compute its diameter. Besides, return the index into the distance matrix
+	// the position of the simplex with the given key among the simplices of dimension d
+	int findSimplex(int d, SimplexKey key) const
+	{
+		typename vector<SimplexKey>::const_iterator it = std::lower_bound(mSimplices[d].begin(), mSimplices[d].end(), key);
+		assert(it != mSimplices[d].end() && *it == key);
+		return it - mSimplices[d].begin();
+	}
+
+	// given a complex, compute its diameter. Besides, return the index of its longest edge into
+	// the packed distances (of its point for a vertex)
 	template<typename InputIterator>
-	double getDiameter(InputIterator begin, InputIterator end, std::pair<int, int> & index) const
+	double getDiameter(InputIterator begin, InputIterator end, int & index) const
 	{
 		if (begin == end) 
 		{
-			index.first = 0;
-			index.second = 0;
+			index = 0;
 			return 0.;
 		}
 
 		double max = 0.;
+		index = *begin;
 		InputIterator curr = begin;
 
 		do 
 		{
 			for (InputIterator run = curr + 1; run != end; run++) 
 			{
-				double cdist = (*mDistanceMatrix)(*curr, *run);
-				if (cdist > max)
+				int cidx = computeIntIndex(std::make_pair(*curr, *run));
+				double cdist = (*mDistances)(cidx);
+				if (index < mPointsNum || cdist > max)
 				{
 					max = cdist;
-					index.first = *curr;
-					index.second = *run;
+					index = cidx;
 				}
 			}
 			curr++;
@@ -269,7 +350,7 @@ private:
 		{
 			for (InputIterator run = curr + 1; run != end; run++)
 			{
-				double cdist = (*mDistanceMatrix)(*curr, *run);
+				double cdist = distance(*curr, *run);
 				if (cdist > max)
 				{
 					max = cdist;
@@ -281,83 +362,31 @@ private:
 		return max;
 	}
 
-	// convert the given complex into one of its subcomplexes, and return the corresponding index
-	// Assume that the input sequence is sorted in decreasing order!
-	template<typename InputIterator>
-	int conversion_with_skip(InputIterator begin, InputIterator end, InputIterator skip) const
-	{
-		int dist = std::distance(begin, end);
-		if (skip != end)
-		{
-			dist--;
-		}
-		assert(dist <= (int)maxDim);
-
-		InputIterator it = begin;
-		int ind = 0;
-
-		for (int k = dist; k >= 1; k--) 
-		{
-			if (it == skip) 
-			{
-				it++;
-			}
-			ind += mBinomials[*it++][k];
-		}
-		ind += mBreakPoints[dist - 1];
-
-		return ind;
-	}
-
-	// given an integer index, convert it to the pair index into the distance matrix
-	std::pair<int, int> computePairIndex(int idx) const
-	{
-		int row = -1, col = -1;
-		int rowNum = mPointsNum;
-
-		while (idx >= 0)
-		{
-			row++;
-			idx -= rowNum;
-			rowNum--;
-		}
-
-		col = mPointsNum + idx;
-
-		return std::make_pair(row, col);
-	}
-
-	// given a pair of indices, covert it to the integer index
+	// given a pair of different points, covert it to the index into the packed distances
 	int computeIntIndex(const std::pair<int, int> & pairIdx) const
 	{
-		int resIdx = 0;
-		int pointsPerRow = mPointsNum;
-
 		int rowCnt = pairIdx.first;
 		int colCnt = pairIdx.second;
 		if (rowCnt > colCnt)
 			SWAP(rowCnt, colCnt);
 
-		while (rowCnt > 0)
-		{
-			resIdx += pointsPerRow;
-			rowCnt--;
-			pointsPerRow--;
-		}
-
-		resIdx += pointsPerRow - (mPointsNum - colCnt);
-
-		return resIdx;
+		return mPointsNum + (int)packedIndex(rowCnt, colCnt, mPointsNum);
 	}
 
 private:
-	vector<int> mBreakPoints; // cumulative cell numbers
+	vector<vector<SimplexKey>> mSimplices; // the keys of the simplices of each dimension, sorted increasingly
 
-	vector<vector<int>> mBinomials; // store the precomputed binomials
+	vector<vector<int>> mOrder; // the positions in mSimplices of the simplices of each dimension, in the filtration order
 
-	const blitz::Array<double, 2> * const mDistanceMatrix; // pointer to the distance matrix data
+	SimplexIndexing<maxDim> mIndexing; // the binomials of the combinatorial keys
+
+	const blitz::Array<double, 1> * const mDistances; // pointer to the packed distances
 
 	int mPointsNum; // number of cloud points
+
+	double mThreshold; // the maximal diameter of the simplices
+
+	static const int BLOCK_SIZE = 4096; // the number of cells handled by one parallel task
 };
 
 #endif // !FULL_RIPS_FILTRATION_H
@@ -0,0 +1,291 @@
+#ifndef GEOMETRIC_PREDICATES_H
+#define GEOMETRIC_PREDICATES_H
+
+#include <vector>
+#include <cmath>
+using namespace std;
+
+/********************************************************************
+* Exact geometric predicates for the Delaunay triangulation (see DelaunayTriangulation): the signs
+* of the orientation and in-sphere determinants of points given by their double coordinates.
+* A determinant is first evaluated in floating point, and its sign is kept if its magnitude
+* exceeds the bound of the rounding error (Shewchuk, "Adaptive precision floating-point arithmetic
+* and fast robust geometric predicates"). Otherwise, which only happens for nearly degenerate
+* configurations, it is evaluated exactly, as an expansion.
+********************************************************************/
+namespace GeometricPredicates
+{
+	/********************************************************************
+	* An expansion: a number represented exactly as the sum of doubles whose bits do not overlap,
+	* in increasing order of magnitude. Sums and products of expansions are computed without
+	* rounding error, with the error-free transformations of two doubles (Two-Sum, Two-Product).
+	********************************************************************/
+	class Expansion
+	{
+	public:
+		Expansion() {}
+
+		Expansion(double a)
+		{
+			if (a != 0.)
+				mTerms.push_back(a);
+		}
+
+		// the exact difference a - b
+		static Expansion difference(double a, double b)
+		{
+			double x = a - b;
+			double bVirtual = a - x;
+			double aVirtual = x + bVirtual;
+			double y = (a - aVirtual) + (bVirtual - b);
+
+			Expansion e;
+			if (y != 0.)
+				e.mTerms.push_back(y);
+			if (x != 0.)
+				e.mTerms.push_back(x);
+			return e;
+		}
+
+		// the sign of the represented number, given by its biggest term
+		int sign() const
+		{
+			return mTerms.empty() ? 0 : (mTerms.back() > 0. ? 1 : -1);
+		}
+
+		friend Expansion operator+(const Expansion & e, const Expansion & f)
+		{
+			Expansion h = e;
+			for (double b : f.mTerms)
+				h.grow(b);
+			return h;
+		}
+
+		friend Expansion operator-(const Expansion & e, const Expansion & f)
+		{
+			Expansion h = e;
+			for (double b : f.mTerms)
+				h.grow(-b);
+			return h;
+		}
+
+		friend Expansion operator*(const Expansion & e, const Expansion & f)
+		{
+			Expansion h;
+			for (double b : f.mTerms)
+				h = h + e.scale(b);
+			return h;
+		}
+
+	private:
+		// the exact sum a + b = x + y, with x the rounded sum
+		static void twoSum(double a, double b, double & x, double & y)
+		{
+			x = a + b;
+			double bVirtual = x - a;
+			double aVirtual = x - bVirtual;
+			y = (a - aVirtual) + (b - bVirtual);
+		}
+
+		// the exact product a * b = x + y, with x the rounded product
+		static void twoProduct(double a, double b, double & x, double & y)
+		{
+			x = a * b;
+			y = std::fma(a, b, -x);
+		}
+
+		// add the double b to the expansion (Shewchuk's GROW-EXPANSION, dropping the zero terms)
+		void grow(double b)
+		{
+			double q = b, h;
+			size_t count = 0;
+			for (size_t i = 0; i < mTerms.size(); ++i)
+			{
+				twoSum(q, mTerms[i], q, h);
+				if (h != 0.)
+					mTerms[count++] = h;
+			}
+			mTerms.resize(count);
+			if (q != 0.)
+				mTerms.push_back(q);
+		}
+
+		// the expansion multiplied by the double b (Shewchuk's SCALE-EXPANSION, dropping the zero terms)
+		Expansion scale(double b) const
+		{
+			Expansion h;
+			if (mTerms.empty() || b == 0.)
+				return h;
+
+			double q, hh;
+			twoProduct(mTerms[0], b, q, hh);
+			if (hh != 0.)
+				h.mTerms.push_back(hh);
+			for (size_t i = 1; i < mTerms.size(); ++i)
+			{
+				double product1, product0, sum;
+				twoProduct(mTerms[i], b, product1, product0);
+				twoSum(q, product0, sum, hh);
+				if (hh != 0.)
+					h.mTerms.push_back(hh);
+				q = product1 + sum; // Fast-Two-Sum: |product1| >= |sum|
+				hh = sum - (q - product1);
+				if (hh != 0.)
+					h.mTerms.push_back(hh);
+			}
+			if (q != 0.)
+				h.mTerms.push_back(q);
+			return h;
+		}
+
+	private:
+		vector<double> mTerms; // the nonzero terms, in increasing order of magnitude
+	};
+
+	// the bounds of the relative rounding error of the floating-point determinants
+	const double EPSILON = std::ldexp(1., -53); // half the distance from 1 to the next double
+	const double ORIENT2D_BOUND = (3. + 16. * EPSILON) * EPSILON;
+	const double ORIENT3D_BOUND = (7. + 56. * EPSILON) * EPSILON;
+	const double INCIRCLE_BOUND = (10. + 96. * EPSILON) * EPSILON;
+	const double INSPHERE_BOUND = (16. + 224. * EPSILON) * EPSILON;
+
+	inline int signOf(double x)
+	{
+		return (x > 0.) - (x < 0.);
+	}
+
+	// 1 if a, b, c are in counterclockwise order, -1 if clockwise, 0 if collinear
+	inline int orient2d(const double * a, const double * b, const double * c)
+	{
+		double left = (a[0] - c[0]) * (b[1] - c[1]);
+		double right = (a[1] - c[1]) * (b[0] - c[0]);
+		double det = left - right;
+		if (std::fabs(det) > ORIENT2D_BOUND * (std::fabs(left) + std::fabs(right)))
+			return signOf(det);
+
+		Expansion acx = Expansion::difference(a[0], c[0]), acy = Expansion::difference(a[1], c[1]);
+		Expansion bcx = Expansion::difference(b[0], c[0]), bcy = Expansion::difference(b[1], c[1]);
+		return (acx * bcy - acy * bcx).sign();
+	}
+
+	// 1 if d lies below the plane of a, b, c (a, b, c appear counterclockwise from above), -1 if above,
+	// 0 if the four points are coplanar
+	inline int orient3d(const double * a, const double * b, const double * c, const double * d)
+	{
+		double adx = a[0] - d[0], ady = a[1] - d[1], adz = a[2] - d[2];
+		double bdx = b[0] - d[0], bdy = b[1] - d[1], bdz = b[2] - d[2];
+		double cdx = c[0] - d[0], cdy = c[1] - d[1], cdz = c[2] - d[2];
+
+		double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+		double cdxady = cdx * ady, adxcdy = adx * cdy;
+		double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+		double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+		double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz)
+			+ (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz)
+			+ (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz);
+		if (std::fabs(det) > ORIENT3D_BOUND * permanent)
+			return signOf(det);
+
+		Expansion eadx = Expansion::difference(a[0], d[0]), eady = Expansion::difference(a[1], d[1]), eadz = Expansion::difference(a[2], d[2]);
+		Expansion ebdx = Expansion::difference(b[0], d[0]), ebdy = Expansion::difference(b[1], d[1]), ebdz = Expansion::difference(b[2], d[2]);
+		Expansion ecdx = Expansion::difference(c[0], d[0]), ecdy = Expansion::difference(c[1], d[1]), ecdz = Expansion::difference(c[2], d[2]);
+		return (eadz * (ebdx * ecdy - ecdx * ebdy) + ebdz * (ecdx * eady - eadx * ecdy) + ecdz * (eadx * ebdy - ebdx * eady)).sign();
+	}
+
+	// for a, b, c in counterclockwise order: 1 if d lies inside their circumcircle, -1 if outside,
+	// 0 if the four points are cocircular
+	inline int incircle(const double * a, const double * b, const double * c, const double * d)
+	{
+		double adx = a[0] - d[0], ady = a[1] - d[1];
+		double bdx = b[0] - d[0], bdy = b[1] - d[1];
+		double cdx = c[0] - d[0], cdy = c[1] - d[1];
+
+		double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+		double cdxady = cdx * ady, adxcdy = adx * cdy;
+		double adxbdy = adx * bdy, bdxady = bdx * ady;
+		double alift = adx * adx + ady * ady;
+		double blift = bdx * bdx + bdy * bdy;
+		double clift = cdx * cdx + cdy * cdy;
+
+		double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+		double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * alift
+			+ (std::fabs(cdxady) + std::fabs(adxcdy)) * blift
+			+ (std::fabs(adxbdy) + std::fabs(bdxady)) * clift;
+		if (std::fabs(det) > INCIRCLE_BOUND * permanent)
+			return signOf(det);
+
+		Expansion eadx = Expansion::difference(a[0], d[0]), eady = Expansion::difference(a[1], d[1]);
+		Expansion ebdx = Expansion::difference(b[0], d[0]), ebdy = Expansion::difference(b[1], d[1]);
+		Expansion ecdx = Expansion::difference(c[0], d[0]), ecdy = Expansion::difference(c[1], d[1]);
+		Expansion ealift = eadx * eadx + eady * eady;
+		Expansion eblift = ebdx * ebdx + ebdy * ebdy;
+		Expansion eclift = ecdx * ecdx + ecdy * ecdy;
+		return (ealift * (ebdx * ecdy - ecdx * ebdy) + eblift * (ecdx * eady - eadx * ecdy) + eclift * (eadx * ebdy - ebdx * eady)).sign();
+	}
+
+	// for a, b, c, d with orient3d(a, b, c, d) > 0: 1 if e lies inside their circumsphere, -1 if outside,
+	// 0 if the five points are cospherical
+	inline int insphere(const double * a, const double * b, const double * c, const double * d, const double * e)
+	{
+		double aex = a[0] - e[0], aey = a[1] - e[1], aez = a[2] - e[2];
+		double bex = b[0] - e[0], bey = b[1] - e[1], bez = b[2] - e[2];
+		double cex = c[0] - e[0], cey = c[1] - e[1], cez = c[2] - e[2];
+		double dex = d[0] - e[0], dey = d[1] - e[1], dez = d[2] - e[2];
+
+		double aexbey = aex * bey, bexaey = bex * aey;
+		double bexcey = bex * cey, cexbey = cex * bey;
+		double cexdey = cex * dey, dexcey = dex * cey;
+		double dexaey = dex * aey, aexdey = aex * dey;
+		double aexcey = aex * cey, cexaey = cex * aey;
+		double bexdey = bex * dey, dexbey = dex * bey;
+
+		double ab = aexbey - bexaey, bc = bexcey - cexbey, cd = cexdey - dexcey;
+		double da = dexaey - aexdey, ac = aexcey - cexaey, bd = bexdey - dexbey;
+
+		double abc = aez * bc - bez * ac + cez * ab;
+		double bcd = bez * cd - cez * bd + dez * bc;
+		double cda = cez * da + dez * ac + aez * cd;
+		double dab = dez * ab + aez * bd + bez * da;
+
+		double alift = aex * aex + aey * aey + aez * aez;
+		double blift = bex * bex + bey * bey + bez * bez;
+		double clift = cex * cex + cey * cey + cez * cez;
+		double dlift = dex * dex + dey * dey + dez * dez;
+
+		double det = (dlift * abc - clift * dab) + (blift * cda - alift * bcd);
+
+		double aezplus = std::fabs(aez), bezplus = std::fabs(bez), cezplus = std::fabs(cez), dezplus = std::fabs(dez);
+		double abplus = std::fabs(aexbey) + std::fabs(bexaey), bcplus = std::fabs(bexcey) + std::fabs(cexbey);
+		double cdplus = std::fabs(cexdey) + std::fabs(dexcey), daplus = std::fabs(dexaey) + std::fabs(aexdey);
+		double acplus = std::fabs(aexcey) + std::fabs(cexaey), bdplus = std::fabs(bexdey) + std::fabs(dexbey);
+		double permanent = (cdplus * bezplus + bdplus * cezplus + bcplus * dezplus) * alift
+			+ (daplus * cezplus + acplus * dezplus + cdplus * aezplus) * blift
+			+ (abplus * dezplus + bdplus * aezplus + daplus * bezplus) * clift
+			+ (bcplus * aezplus + acplus * bezplus + abplus * cezplus) * dlift;
+		if (std::fabs(det) > INSPHERE_BOUND * permanent)
+			return signOf(det);
+
+		Expansion eaex = Expansion::difference(a[0], e[0]), eaey = Expansion::difference(a[1], e[1]), eaez = Expansion::difference(a[2], e[2]);
+		Expansion ebex = Expansion::difference(b[0], e[0]), ebey = Expansion::difference(b[1], e[1]), ebez = Expansion::difference(b[2], e[2]);
+		Expansion ecex = Expansion::difference(c[0], e[0]), ecey = Expansion::difference(c[1], e[1]), ecez = Expansion::difference(c[2], e[2]);
+		Expansion edex = Expansion::difference(d[0], e[0]), edey = Expansion::difference(d[1], e[1]), edez = Expansion::difference(d[2], e[2]);
+
+		Expansion eab = eaex * ebey - ebex * eaey, ebc = ebex * ecey - ecex * ebey, ecd = ecex * edey - edex * ecey;
+		Expansion eda = edex * eaey - eaex * edey, eac = eaex * ecey - ecex * eaey, ebd = ebex * edey - edex * ebey;
+
+		Expansion eabc = eaez * ebc - ebez * eac + ecez * eab;
+		Expansion ebcd = ebez * ecd - ecez * ebd + edez * ebc;
+		Expansion ecda = ecez * eda + edez * eac + eaez * ecd;
+		Expansion edab = edez * eab + eaez * ebd + ebez * eda;
+
+		Expansion ealift = eaex * eaex + eaey * eaey + eaez * eaez;
+		Expansion eblift = ebex * ebex + ebey * ebey + ebez * ebez;
+		Expansion eclift = ecex * ecex + ecey * ecey + ecez * ecez;
+		Expansion edlift = edex * edex + edey * edey + edez * edez;
+
+		return ((edlift * eabc - eclift * edab) + (eblift * ecda - ealift * ebcd)).sign();
+	}
+}
+
+#endif // !GEOMETRIC_PREDICATES_H
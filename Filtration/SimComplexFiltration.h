@@ -1,8 +1,11 @@
 #ifndef SIM_COMPLEX_FILTRATION_H
 #define SIM_COMPLEX_FILTRATION_H
 
+#include <array>
 #include "AbstractFiltration.h"
 #include "InputFileInfo.h"
+#include "ThreadPool.h"
+#include "SimplexTable.h"
 
 template<int dim>
 class SimComplexFiltration : public AbstractFiltration<dim, 1, 1> // arrayDim = 1 for storing point values in 1D array; vertexDim = 1 for 1D index 
@@ -52,112 +55,70 @@ public:
 	// and the cellToVertex list, which records the mapping from each cell to the component vertices
 	void initList(std::vector<int> *birth_list, vector<MatrixListType> *cell2v_list, int d, bool verbose=false)
 	{
-		typedef std::tuple<int, double, int, vector<int>> elemType;
-
 		int cellNum = getSizeInDim(d);
-		birth_list->resize(cellNum);
-		birth_list->clear();
-
-		vector<int> pointsIdxVector;
-		vector<elemType> birthVector;
-		double filterValue;
-		int maxIdx;
-
-		for (int i = 0; i < cellNum; ++i)
-		{
-			filterValue = getFilterValue(mCells[d][i].begin(), mCells[d][i].end(), maxIdx);
-
-			pointsIdxVector.clear();
-			std::copy(mCells[d][i].begin(), mCells[d][i].end(), std::back_inserter(pointsIdxVector));
-			std::sort(pointsIdxVector.begin(), pointsIdxVector.end()); // need to sort it in ascending order for future use
-			
-			birthVector.push_back(std::make_tuple(i, filterValue, maxIdx, pointsIdxVector));
-		}
 
-		// sort the cells in nondecreasing order
-		std::sort(birthVector.begin(), birthVector.end(),
-			[](elemType const & a, elemType const & b) {return std::get<1>(a) < std::get<1>(b);});
+		vector<int> births(cellNum);
+		vector<std::pair<double, int>> order = sortedCells(d, births);
 
-		// copy the birth time
-		std::transform(birthVector.begin(), birthVector.end(), std::back_inserter(*birth_list),
-			[](elemType const & a) {return std::get<2>(a);});
+		// gather the birth time and the vertices of each cell in the filtration order,
+		// and keep the order for calculateBoundaries
+		birth_list->resize(cellNum);
+		cell2v_list->resize(cellNum);
+		mOrder[d].resize(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			for (int k = begin; k < end; ++k)
+			{
+				int i = order[k].second;
+				mOrder[d][k] = i;
+				(*birth_list)[k] = births[i];
 
-		// compute the cell_ to_vertices list
-		std::transform(birthVector.begin(), birthVector.end(), std::back_inserter(*cell2v_list),
-			[](elemType const & a) {return std::get<3>(a);});
+				MatrixListType & points = (*cell2v_list)[k];
+				points.assign(cell(d, i), cell(d, i) + d + 1);
+				std::sort(points.begin(), points.end()); // need to sort it in ascending order for future use
+			}
+		});
 	}
 
 	// compute the d-dimensional boundary matrix 
 	void calculateBoundaries(vector<MatrixListType> *boundary, int d, const vector<bool> & will_be_cleared)
 	{
-		typedef std::pair<double, vector<int>> filterIdxType;
-		typedef std::tuple<int, double, vector<int>> elemType;
-
 		int cellNum = getSizeInDim(d);
-		boundary->resize(cellNum);
-		boundary->clear();
-
-		vector<int> pointsIdxVector, subcomplexIdxVector, subcomplex;
-		vector<filterIdxType> subcomplexVector;
-		vector<elemType> birthVector;
-		double filterValue;
-		int maxIdx;
 
-		// first, list the subcomplex of dimension d-1
-		int subComplexNum = getSizeInDim(d - 1);
-		for (int i = 0; i < subComplexNum; ++i)
-		{
-			pointsIdxVector.clear();
-			std::copy(mCells[d-1][i].begin(), mCells[d-1][i].end(), std::back_inserter(pointsIdxVector));
-			std::sort(pointsIdxVector.begin(), pointsIdxVector.end()); // sort it such that it could be used as a key in map
-
-			filterValue = getFilterValue(mCells[d-1][i].begin(), mCells[d-1][i].end(), maxIdx);
-
-			subcomplexVector.push_back(std::make_pair(filterValue, pointsIdxVector));
-		}
-
-		// sort
-		std::sort(subcomplexVector.begin(), subcomplexVector.end(),
-			[](filterIdxType const & a, filterIdxType const &b) {return a.first < b.first;});
-
-		// create mapping
-		std::map<vector<int>, int> map2order;
-		for (int i = 0; i < subcomplexVector.size(); ++i)
-		{
-			map2order[subcomplexVector[i].second] = i;
-		}
-
-
-		// create the boundary matrix
-		for (int i = 0; i < cellNum; ++i)
-		{
-			pointsIdxVector.clear();
-			std::copy(mCells[d][i].begin(), mCells[d][i].end(), std::back_inserter(pointsIdxVector));
-			std::sort(pointsIdxVector.begin(), pointsIdxVector.end());
-
-			filterValue = getFilterValue(mCells[d][i].begin(), mCells[d][i].end(), maxIdx);
-			
-			subcomplexIdxVector.clear();
-			for (auto skip : pointsIdxVector)
+		// index each (d-1)-cell, given by its sorted vertices, by its position in the filtration order, which initList has computed
+		const vector<int> & subcomplexOrder = mOrder[d - 1];
+		SimplexTable table(d, subcomplexOrder.size());
+		parallelForBlocks(subcomplexOrder.size(), BLOCK_SIZE, [&](int begin, int end, int) {
+			for (int k = begin; k < end; ++k)
 			{
-				subcomplex.clear();
-				std::copy_if(pointsIdxVector.begin(), pointsIdxVector.end(), std::back_inserter(subcomplex),
-					[skip](const int & t) {return t != skip;});
-				subcomplexIdxVector.push_back(map2order.at(subcomplex)); // get the integer index for this subcomlex, and store it
+				int * points = table.vertices(k);
+				std::copy(cell(d - 1, subcomplexOrder[k]), cell(d - 1, subcomplexOrder[k]) + d, points);
+				std::sort(points, points + d);
 			}
+		});
+		table.build();
 
-			birthVector.push_back(std::make_tuple(i, filterValue, subcomplexIdxVector));
-		}
-
-		// sort the boundary matrix columns
-		std::sort(birthVector.begin(), birthVector.end(),
-			[](elemType const & a, elemType const & b) {return std::get<1>(a) < std::get<1>(b);});
-
-		std::transform(birthVector.begin(), birthVector.end(), std::back_inserter(*boundary),
-			[](elemType const & a) {return std::get<2>(a);});
+		// build the columns directly in the filtration order of the d-cells, in parallel;
+		// the faces are the sorted vertices of the cell with one of them left out
+		boundary->resize(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			std::array<int, dim + 1> points, face;
+			for (int k = begin; k < end; ++k)
+			{
+				std::copy(cell(d, mOrder[d][k]), cell(d, mOrder[d][k]) + d + 1, points.begin());
+				std::sort(points.begin(), points.begin() + d + 1);
 
-		for (std::vector<MatrixListType>::iterator it = boundary->begin(), end = boundary->end(); it != end; ++it)
-			mysort(*it);
+				MatrixListType & column = (*boundary)[k];
+				for (int skip = 0; skip <= d; ++skip)
+				{
+					std::copy(points.begin(), points.begin() + skip, face.begin());
+					std::copy(points.begin() + skip + 1, points.begin() + d + 1, face.begin() + skip);
+					int position = table.find(face.data());
+					assert(position >= 0);
+					column.push_back(position);
+				}
+				mysort(column);
+			}
+		});
 	}
 
 private:
@@ -173,12 +134,11 @@ private:
 		f.read(reinterpret_cast<char*>(&dimPoints), sizeof(int)); // read dimension of each point
 
 		mCells.resize(maxDim + 1); // initialize for the cells of dimension 0
-		for (int i = 0; i < numPoints; ++i)
-		{
-			mCells[0].push_back(vector<int>(1, i));
-		}
+		mCells[0].resize(numPoints);
+		std::iota(mCells[0].begin(), mCells[0].end(), 0);
 
 		mCellNums.resize(maxDim + 1);
+		mOrder.resize(maxDim + 1);
 		mCellNums[0] = numPoints;
 
 		vector<vector<double>> posPoints;
@@ -202,20 +162,39 @@ private:
 				break;
 
 			mCellNums[cellDim] = cellNum;
-			mCells[cellDim].resize(cellNum);
-			for (int i = 0; i < cellNum; ++i)
-			{
-				mCells[cellDim][i].resize(cellDim + 1);
-				for (int j = 0; j <= cellDim; ++j)
-				{
-					f.read(reinterpret_cast<char*>(&mCells[cellDim][i][j]), sizeof(int));	 // read cell dimension
-				}
-			}
+			mCells[cellDim].resize((size_t)cellNum * (cellDim + 1));
+			f.read(reinterpret_cast<char*>(mCells[cellDim].data()), sizeof(int) * mCells[cellDim].size()); // read the vertices of the cells
 		}
 
 		f.close();
 	}
 
+	// the d-cells in the filtration order, as (value, position) keys sorted increasingly, ties broken by the
+	// position of the cell in the input; births receives the birth vertex of each cell (by position).
+	// Sorting these compact keys instead of the cells themselves avoids moving the vertex lists around.
+	vector<std::pair<double, int>> sortedCells(int d, vector<int> & births) const
+	{
+		int cellNum = mCellNums[d];
+		vector<std::pair<double, int>> order(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			int maxIdx;
+			for (int i = begin; i < end; ++i)
+			{
+				order[i] = std::make_pair(getFilterValue(cell(d, i), cell(d, i) + d + 1, maxIdx), i);
+				births[i] = maxIdx;
+			}
+		});
+
+		parallelSort(order.begin(), order.end());
+		return order;
+	}
+
+	// the vertices of the d-cell i, in the input order
+	const int * cell(int d, int i) const
+	{
+		return mCells[d].data() + (size_t)i * (d + 1);
+	}
+
 	template<typename InputIterator>
 	double getFilterValue(InputIterator begin, InputIterator end, int & maxIdx) const
 	{
@@ -251,8 +230,14 @@ private:
 	// Number of cells
 	vector<int> mCellNums;
 
-	// Cells (consisting of indices)
-	vector<vector<vector<int>>> mCells;
+	// The positions of the cells of each dimension, in the filtration order
+	vector<vector<int>> mOrder;
+
+	// Cells (consisting of indices): the vertices of the d-cell i are mCells[d][i * (d + 1) .. (i + 1) * (d + 1) - 1]
+	vector<vector<int>> mCells;
+
+	// The number of cells handled by one parallel task
+	static const int BLOCK_SIZE = 4096;
 };
 
 #endif // !SIM_COMPLEX_FILTRATION_H
@@ -0,0 +1,102 @@
+#ifndef SIMPLEX_INDEXING_H
+#define SIMPLEX_INDEXING_H
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <cassert>
+
+/********************************************************************
+* Combinatorial indexing of the simplices on a set of points, shared by the Rips filtrations.
+* A simplex with vertices v_0 < ... < v_k is identified by its 64-bit key sum_i C(v_i, i + 1);
+* the keys of the simplices of one dimension are distinct, and extending a simplex by a vertex
+* bigger than all of its vertices adds C(v, k + 2) to its key.
+********************************************************************/
+template<int maxDim>
+class SimplexIndexing
+{
+public:
+	typedef long long SimplexKey; // C(n, k) overflows int already for a few thousand points
+
+	// precompute the binomials C(i, k) for i <= pointsNum and k <= maxDim + 1, stored as mBinomials[k][i]
+	void init(int pointsNum)
+	{
+		mPointsNum = pointsNum;
+		mBinomials.assign(maxDim + 2, std::vector<SimplexKey>(mPointsNum + 1, 0));
+		for (int i = 0; i <= mPointsNum; ++i)
+		{
+			mBinomials[0][i] = 1;
+			for (int k = 1; k <= maxDim + 1; ++k)
+			{
+				if (i == 0)
+					continue;
+				SimplexKey a = mBinomials[k - 1][i - 1], b = mBinomials[k][i - 1]; // C(i, k) = C(i - 1, k - 1) + C(i - 1, k)
+				if (a > std::numeric_limits<SimplexKey>::max() - b)
+				{
+					std::cerr << "Too many points (" << mPointsNum << ") to index the Rips simplices of dimension " << maxDim << " with 64 bits." << std::endl;
+					exit(EXIT_FAILURE);
+				}
+				mBinomials[k][i] = a + b;
+			}
+		}
+	}
+
+	// the key of the d-simplex made of the (d-1)-simplex with the given key and a vertex v bigger than its vertices
+	SimplexKey extend(SimplexKey key, int d, int v) const
+	{
+		return key + mBinomials[d + 1][v];
+	}
+
+	// key of a d-dimensional simplex -> set of points (in decreasing index order)
+	void conversion(int d, SimplexKey key, std::vector<int> & out) const
+	{
+		out.clear();
+
+		int bcoeff = mPointsNum - 1;
+		for (int k = d; k >= 0; k--)
+		{
+			// the biggest vertex v <= bcoeff with C(v, k + 1) <= key
+			const std::vector<SimplexKey> & column = mBinomials[k + 1];
+			bcoeff = std::upper_bound(column.begin(), column.begin() + bcoeff + 1, key) - column.begin() - 1;
+			out.push_back(bcoeff);
+			key -= column[bcoeff];
+			bcoeff--;
+		}
+	}
+
+	// convert the given complex into one of its subcomplexes, and return the key of the subcomplex
+	// Assume that the input sequence is sorted in decreasing order!
+	template<typename InputIterator>
+	SimplexKey conversion_with_skip(InputIterator begin, InputIterator end, InputIterator skip) const
+	{
+		int dist = std::distance(begin, end);
+		if (skip != end)
+		{
+			dist--;
+		}
+		assert(dist <= (int)maxDim);
+
+		InputIterator it = begin;
+		SimplexKey ind = 0;
+
+		for (int k = dist; k >= 1; k--)
+		{
+			if (it == skip)
+			{
+				it++;
+			}
+			ind += mBinomials[k][*it++];
+		}
+
+		return ind;
+	}
+
+private:
+	std::vector<std::vector<SimplexKey>> mBinomials; // store the precomputed binomials
+
+	int mPointsNum = 0; // number of points
+};
+
+#endif // !SIMPLEX_INDEXING_H
@@ -0,0 +1,91 @@
+#ifndef SIMPLEX_TABLE_H
+#define SIMPLEX_TABLE_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+/********************************************************************
+* A hash table from the simplices of one dimension, given by their sorted vertices, to their
+* numbers 0 .. n - 1 (e.g., their positions in the filtration order).
+* The vertices of all the simplices are stored back to back with a fixed width, and the table
+* is open-addressed with linear probing over the simplex numbers, so a lookup hashes and compares
+* a few integers in place instead of building a key, and nothing is allocated per simplex.
+* Fill the vertices of each simplex (vertices(i), in increasing order), then call build().
+********************************************************************/
+class SimplexTable
+{
+public:
+	// a table for numSimplices simplices of numVertices vertices each
+	SimplexTable(int numVertices, int numSimplices)
+		: mWidth(numVertices), mVertices((size_t)numVertices * numSimplices)
+	{
+		size_t capacity = 1;
+		while (capacity < 2 * (size_t)numSimplices) // load factor at most 1/2
+			capacity *= 2;
+		mSlots.assign(capacity, -1);
+		mMask = capacity - 1;
+	}
+
+	// the vertices of simplex i, to be filled in increasing order
+	int * vertices(int i)
+	{
+		return mVertices.data() + (size_t)i * mWidth;
+	}
+
+	// insert all the simplices, once their vertices are filled
+	void build()
+	{
+		int numSimplices = mVertices.size() / mWidth;
+		for (int i = 0; i < numSimplices; ++i)
+		{
+			size_t slot = hash(vertices(i)) & mMask;
+			while (mSlots[slot] >= 0)
+				slot = (slot + 1) & mMask;
+			mSlots[slot] = i;
+		}
+	}
+
+	// the number of the simplex with the given sorted vertices, or -1 if it is not in the table
+	int find(const int * v) const
+	{
+		size_t slot = hash(v) & mMask;
+		while (mSlots[slot] >= 0)
+		{
+			const int * w = mVertices.data() + (size_t)mSlots[slot] * mWidth;
+			if (std::equal(v, v + mWidth, w))
+				return mSlots[slot];
+			slot = (slot + 1) & mMask;
+		}
+		return -1;
+	}
+
+private:
+	// mix the vertices with the finalizer of splitmix64
+	uint64_t hash(const int * v) const
+	{
+		uint64_t h = 0;
+		for (int k = 0; k < mWidth; ++k)
+		{
+			h = (h ^ (uint32_t)v[k]) * 0x9E3779B97F4A7C15ULL;
+			h ^= h >> 31;
+		}
+		h ^= h >> 30;
+		h *= 0xBF58476D1CE4E5B9ULL;
+		h ^= h >> 27;
+		h *= 0x94D049BB133111EBULL;
+		h ^= h >> 31;
+		return h;
+	}
+
+private:
+	int mWidth; // the number of vertices of each simplex
+
+	std::vector<int> mVertices; // the sorted vertices of simplex i are mVertices[i * mWidth .. (i + 1) * mWidth - 1]
+
+	std::vector<int> mSlots; // the simplex number in each slot, -1 if the slot is empty
+
+	size_t mMask; // the number of slots minus 1 (a power of 2)
+};
+
+#endif // !SIMPLEX_TABLE_H
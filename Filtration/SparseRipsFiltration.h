@@ -0,0 +1,326 @@
+#ifndef SPARSE_RIPS_FILTRATION_H
+#define SPARSE_RIPS_FILTRATION_H
+
+#include "AbstractFiltration.h"
+#include "SimplexIndexing.h"
+#include "EdgeCollapse.h"
+#include "InputFileInfo.h"
+#include "DataReaders/DataReaderSparseRips.h"
+#include "DataReaders/DataReaderPointCloud.h"
+
+/********************************************************************
+* Rips filtration of a sparse distance matrix (see SparseEdgeList): the flag complex of the
+* edge list, i.e., a simplex exists if all of its edges are listed, and it appears at the
+* length of its longest edge. The edges are kept as adjacency lists, so the memory scales
+* with the number of edges and simplices instead of the square of the number of points.
+* A point cloud (see PointCloud) is turned into the edge list of its pairs of points within
+* the Rips threshold, which defaults to the enclosing radius as in FullRipsFiltration, or, with
+* Globals::rips_epsilon > 0, into the edges of its sparse Rips filtration (see PointCloud::sparseEdgeList),
+* which approximates the Rips filtration with a number of edges linear in the number of points.
+* The dominated edges are optionally collapsed first, as in FullRipsFiltration.
+* The flag complex of a sparse distance matrix need not fill up the space (nor does a point cloud
+* truncated below its enclosing radius), so some classes may never die; they are saved as dying
+* at infinity.
+* The filtration reads the input file itself and fills the values array passed to it.
+* The values are stored in a 1D array (SparseEdgeList::filtrationValues): entry p < n is the
+* point p, and entry n + e carries the length of edge e. These entries serve as the vertex
+* list (IndexVertexList), so a cell is born at the entry of its longest edge (of its point for
+* the vertices), and the cycles are given by their point indices.
+* As in FullRipsFiltration, the simplices of each dimension are kept as a sorted list of their
+* combinatorial keys, and a cell is addressed by its position in that list.
+********************************************************************/
+template<int maxDim>
+class SparseRipsFiltration : public AbstractFiltration<maxDim, 1, 1, IndexVertexList> // arrayDim = 1 for the values of the points and edges; vertexDim = 1 for 1D index
+{
+	typedef typename SimplexIndexing<maxDim>::SimplexKey SimplexKey;
+
+public:
+	// constructor
+	SparseRipsFiltration(blitz::Array<double, 1> *const p, const InputFileInfo &info) : mValues(p)
+	{
+		readEdges(info, p);
+		mIndexing.init(mPointsNum);
+		enumerateSimplices();
+
+		if (info.verbose)
+		{
+			cout << "Sparse Rips filtration of " << mPointsNum << " points and " << mNeighbors.size() << " edges" << endl;
+			for (int d = 2; d <= maxDim; ++d)
+				cout << "Number of " << d << "-simplices: " << mSimplices[d].size() << endl;
+		}
+	}
+
+	// initialize the vertex list, which will be used for indexing birth time and death time
+	void init(IndexVertexList *vList)
+	{
+		vList->count = mValues->extent(0);
+	}
+
+	// return the number of cells in dimension d
+	int getSizeInDim(int d)
+	{
+		return mSimplices[d].size();
+	}
+
+	// initialize the birth list, which records the birth time for each cell;
+	// and the cellToVertex list, which records the mapping from each cell to the component vertices
+	void initList(std::vector<int> *birth_list, vector<MatrixListType> *cell2v_list, int d, bool =false)
+	{
+		int cellNum = getSizeInDim(d);
+
+		vector<int> births(cellNum);
+		vector<std::pair<double, int>> order = sortedCells(d, births);
+
+		// gather the birth time and the vertices of each cell in the filtration order,
+		// and keep the order for calculateBoundaries
+		birth_list->resize(cellNum);
+		cell2v_list->resize(cellNum);
+		mOrder[d].resize(cellNum);
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int) {
+			for (int k = begin; k < end; ++k)
+			{
+				int i = order[k].second;
+				mOrder[d][k] = i;
+				(*birth_list)[k] = births[i];
+
+				MatrixListType & points = (*cell2v_list)[k];
+				mIndexing.conversion(d, mSimplices[d][i], points);
+				std::reverse(points.begin(), points.end()); // need to sort it in ascending order for future use
+			}
+		});
+	}
+
+	// compute the d-dimensional boundary matrix
+	void calculateBoundaries(vector<MatrixListType> *boundary, int d, const vector<bool> &)
+	{
+		int cellNum = getSizeInDim(d);
+
+		// the position of each (d-1)-simplex in the filtration order, which initList has computed
+		const vector<int> & subcomplexOrder = mOrder[d - 1];
+		vector<int> position(subcomplexOrder.size());
+		for (int k = 0; k < subcomplexOrder.size(); ++k)
+		{
+			position[subcomplexOrder[k]] = k;
+		}
+
+		// build the columns directly in the filtration order of the d-simplices, in parallel
+		boundary->resize(cellNum);
+		vector<vector<int>> buffers(getThreadPool().size());
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int worker) {
+			vector<int> & pointsIdxVector = buffers[worker];
+			for (int k = begin; k < end; ++k)
+			{
+				mIndexing.conversion(d, mSimplices[d][mOrder[d][k]], pointsIdxVector);
+
+				MatrixListType & column = (*boundary)[k];
+				for (vector<int>::const_iterator skip = pointsIdxVector.begin(); skip != pointsIdxVector.end(); skip++)
+					column.push_back(position[findSimplex(d - 1, mIndexing.conversion_with_skip(pointsIdxVector.cbegin(), pointsIdxVector.cend(), skip))]);
+				mysort(column);
+			}
+		});
+	}
+
+	// the factor within which the persistence diagram approximates the exact one (1: exact)
+	double approximationFactor() const
+	{
+		return mApproximationFactor;
+	}
+
+	// the cycles of a collapsed complex are not proven optimal
+	bool hasOptimalCycles() const
+	{
+		return !Globals::edge_collapse;
+	}
+
+private:
+	// read the edge list (or compute it from the point cloud), store it as adjacency lists and fill the values
+	void readEdges(const InputFileInfo &info, blitz::Array<double, 1> *values)
+	{
+		SparseEdgeList edgeList;
+		if (info.file_type == Globals::FileType::POINT_CLOUD)
+		{
+			PointCloud cloud;
+			if (info.binary)
+			{
+				RawDataReaderPointCloud reader;
+				reader.read(info.input_path, cloud);
+			}
+			else
+			{
+				TextDataReaderPointCloud reader;
+				reader.read(info.input_path, cloud);
+			}
+
+			if (Globals::rips_threshold >= 0)
+			{
+				double enclosingRadius = cloud.enclosingRadius();
+				if (Globals::rips_threshold < enclosingRadius)
+					cout << "Warning: the Rips threshold " << Globals::rips_threshold << " is below the enclosing radius " << enclosingRadius
+						<< "; the classes alive at the threshold never die" << endl;
+			}
+
+			if (Globals::rips_epsilon > 0)
+			{
+				double threshold = (Globals::rips_threshold < 0) ? std::numeric_limits<double>::infinity() : Globals::rips_threshold;
+				cloud.sparseEdgeList(Globals::rips_epsilon, threshold, edgeList);
+				mApproximationFactor = 1. / (1. - Globals::rips_epsilon);
+				if (info.verbose)
+					cout << "Sparse Rips filtration with epsilon " << Globals::rips_epsilon << ", approximation factor " << mApproximationFactor << endl;
+			}
+			else
+			{
+				double threshold = (Globals::rips_threshold < 0) ? cloud.enclosingRadius() : Globals::rips_threshold;
+				if (info.verbose)
+					cout << "Rips filtration truncated at diameter " << threshold << endl;
+				cloud.edgeList(threshold, edgeList);
+			}
+		}
+		else if (info.binary)
+		{
+			RawDataReaderSparseRips reader;
+			reader.read(info.input_path, edgeList);
+		}
+		else
+		{
+			TextDataReaderSparseRips reader;
+			reader.read(info.input_path, edgeList);
+		}
+		edgeList.filtrationValues(*values);
+
+		// the edges are sorted by (i, j) with i < j, so the neighbors of i with a bigger index
+		// are consecutive, and the position of an edge in mNeighbors is its index
+		mPointsNum = edgeList.numPoints;
+		mNeighborOffsets.assign(mPointsNum + 1, 0);
+		mNeighbors.resize(edgeList.edges.size());
+		for (size_t e = 0; e < edgeList.edges.size(); ++e)
+		{
+			mNeighborOffsets[edgeList.edges[e].first + 1]++;
+			mNeighbors[e] = edgeList.edges[e].second;
+		}
+		for (int i = 0; i < mPointsNum; ++i)
+			mNeighborOffsets[i + 1] += mNeighborOffsets[i];
+
+		if (Globals::edge_collapse)
+		{
+			EdgeCollapser collapser(mPointsNum, edgeList.edges, edgeList.lengths);
+			mKept = collapser.collapse();
+			if (info.verbose)
+				cout << "Edge collapse kept " << std::count(mKept.begin(), mKept.end(), 1) << " of " << mKept.size() << " edges" << endl;
+		}
+	}
+
+	// the index of the edge (i, j) with i < j, or -1 if it is not in the complex
+	int findEdge(int i, int j) const
+	{
+		vector<int>::const_iterator first = mNeighbors.begin() + mNeighborOffsets[i], last = mNeighbors.begin() + mNeighborOffsets[i + 1];
+		vector<int>::const_iterator it = std::lower_bound(first, last, j);
+		return (it != last && *it == j && (mKept.empty() || mKept[it - mNeighbors.begin()])) ? it - mNeighbors.begin() : -1;
+	}
+
+	// enumerate the cliques of the edge list, in each dimension by extending the simplices of the
+	// dimension below with a bigger neighbor of their biggest vertex
+	void enumerateSimplices()
+	{
+		mSimplices.assign(maxDim + 1, vector<SimplexKey>());
+		mOrder.assign(maxDim + 1, vector<int>());
+		for (int i = 0; i < mPointsNum; ++i)
+			mSimplices[0].push_back(i);
+
+		vector<int> pointsIdxVector;
+		for (int d = 1; d <= maxDim; ++d)
+		{
+			for (SimplexKey key : mSimplices[d - 1])
+			{
+				mIndexing.conversion(d - 1, key, pointsIdxVector); // pointsIdxVector[0] is the biggest vertex
+				int biggest = pointsIdxVector[0];
+				for (int n = mNeighborOffsets[biggest]; n < mNeighborOffsets[biggest + 1]; ++n)
+				{
+					if (!mKept.empty() && !mKept[n])
+						continue;
+					int v = mNeighbors[n];
+					bool isClique = true;
+					for (size_t k = 1; k < pointsIdxVector.size() && isClique; ++k)
+						isClique = findEdge(pointsIdxVector[k], v) >= 0;
+					if (isClique)
+						mSimplices[d].push_back(mIndexing.extend(key, d, v));
+				}
+			}
+			std::sort(mSimplices[d].begin(), mSimplices[d].end());
+		}
+	}
+
+	// the d-simplices in the filtration order, as (value, position) keys sorted increasingly, ties broken by
+	// the simplex key; births receives the birth index of each simplex (by position)
+	vector<std::pair<double, int>> sortedCells(int d, vector<int> & births) const
+	{
+		int cellNum = mSimplices[d].size();
+		vector<std::pair<double, int>> order(cellNum);
+		vector<vector<int>> buffers(getThreadPool().size());
+		parallelForBlocks(cellNum, BLOCK_SIZE, [&](int begin, int end, int worker) {
+			vector<int> & pointsIdxVector = buffers[worker];
+			int birthIdx;
+			for (int i = begin; i < end; ++i)
+			{
+				mIndexing.conversion(d, mSimplices[d][i], pointsIdxVector);
+				order[i] = std::make_pair(getFilterValue(pointsIdxVector, birthIdx), i);
+				births[i] = birthIdx;
+			}
+		});
+
+		parallelSort(order.begin(), order.end());
+		return order;
+	}
+
+	// the position of the simplex with the given key among the simplices of dimension d
+	int findSimplex(int d, SimplexKey key) const
+	{
+		typename vector<SimplexKey>::const_iterator it = std::lower_bound(mSimplices[d].begin(), mSimplices[d].end(), key);
+		assert(it != mSimplices[d].end() && *it == key);
+		return it - mSimplices[d].begin();
+	}
+
+	// the value of a simplex (points in decreasing index order), i.e., the length of its longest
+	// edge; birthIdx is the vertex carrying this value
+	double getFilterValue(const vector<int> & points, int & birthIdx) const
+	{
+		birthIdx = points[0];
+		double max = 0.;
+		for (size_t a = 1; a < points.size(); ++a)
+		{
+			for (size_t b = 0; b < a; ++b)
+			{
+				int e = findEdge(points[a], points[b]);
+				double length = (*mValues)(mPointsNum + e);
+				if (birthIdx < mPointsNum || length > max)
+				{
+					max = length;
+					birthIdx = mPointsNum + e;
+				}
+			}
+		}
+		return max;
+	}
+
+private:
+	vector<vector<SimplexKey>> mSimplices; // the keys of the simplices of each dimension, sorted increasingly
+
+	vector<vector<int>> mOrder; // the positions in mSimplices of the simplices of each dimension, in the filtration order
+
+	SimplexIndexing<maxDim> mIndexing; // the binomials of the combinatorial keys
+
+	vector<int> mNeighborOffsets; // the neighbors of point i with a bigger index are mNeighbors[mNeighborOffsets[i] .. mNeighborOffsets[i + 1] - 1]
+
+	vector<int> mNeighbors; // the bigger endpoint of each edge
+
+	vector<char> mKept; // whether each edge survives the edge collapse; empty if the edges are not collapsed
+
+	const blitz::Array<double, 1> * const mValues; // the values of the points and edges
+
+	int mPointsNum; // number of points
+
+	double mApproximationFactor = 1.; // 1 / (1 - epsilon) for the sparse Rips filtration of a point cloud
+
+	static const int BLOCK_SIZE = 4096; // the number of cells handled by one parallel task
+};
+
+#endif // !SPARSE_RIPS_FILTRATION_H
@@ -25,27 +25,75 @@ namespace Globals
 
 	int which_alg = 0;								// 0: proposed heuristic-based annotation algorithm
 															// 1: classical annotation algorithm (exhaustive search)
+															// 2: choose between the two for each homology class by a cost model
+															// 3: bidirectional version of the heuristic-based algorithm
 
 	int max_dim = 2;								// the maximum dimension to be computed
 
-	int num_threads = 8;						    // the number of threads for computing the edge annotations
+	int num_threads = 8;						    // the number of worker threads (optimal cycles and edge annotations)
+
+	int pattern_size = 1;							// the number of annotation bits covered by each pattern database of A*
+													// heuristic; 1 gives the classical 1d covering graph heuristic
+
+	int pattern_memory = 1024;						// the memory budget (MB) for the pattern databases of one homology class
+
+	unsigned int spanning_tree_seed = 0;			// seed for choosing the roots of the spanning forest used by the annotations
+
+	long long max_expanded_nodes = 0;				// budgets of the optimal cycle search of one homology class; once one is
+	int max_search_memory = 0;						// exhausted, the reduced cycle is kept and marked as not proven optimal.
+	double max_search_time = 0;						// nodes, MB and seconds respectively; 0 means unlimited
+
+	int search_window = 0;							// if positive, the optimal cycle of an image is searched within this halo (in
+													// pixels) around the bounding box of the reduced cycle; 0 searches the whole image
+
+	double rips_threshold = -1;						// the maximal diameter of the simplices of a Rips filtration;
+													// negative: the enclosing radius of the points (all the edges of a sparse distance matrix)
+
+	double minkowski_p = 2;							// the exponent of the Minkowski distance between the points of a point cloud
+													// (1: Manhattan, 2: Euclidean, infinity: Chebyshev)
+
+	double rips_epsilon = 0;						// if positive, a point cloud gets the sparse Rips filtration with this epsilon, whose
+													// diagram is within a factor 1 / (1 - epsilon) of the Rips diagram; 0: exact
+
+	bool alpha_complex = false;						// a point cloud of dimension 2 or 3 gets the alpha filtration of its Delaunay
+													// triangulation instead of the Rips filtration; the values are radii
+
+	bool edge_collapse = false;						// remove the dominated edges of a Rips filtration before building its simplices;
+													// the diagram is unchanged, the cycles are searched in the smaller complex
+													// and not reported as optimal
+
+	bool lazy_representatives = false;				// keep the reduction and boundary lists in compact form, and build their
+													// vertex coordinates only for the pairs requested afterwards
 
 	std::string inputFileName;					    // input data file name
 
 	std::string memoryFileName_HeuristicAlg = "Memory_Footprint_HeuristicAlg.txt";
 	std::string memoryFileName_ClassicalAlg = "Memory_Footprint_ClassicalAlg.txt";
+	std::string memoryFileName_AutoAlg = "Memory_Footprint_AutoAlg.txt";
 
 	enum Algorithm
 	{
 		HEURISTIC_BASED_ALG = 0,
 		CLASSICAL_ALG = 1,
+		AUTO_ALG = 2,
+		BIDIRECTIONAL_ALG = 3,
+	};
+
+	enum CycleStatus
+	{
+		NOT_OPTIMIZED = 0,		// the cycle is the reduced boundary, or was searched in a collapsed complex (edge_collapse)
+		OPTIMAL = 1,			// the cycle is a shortest representative
+		BUDGET_EXCEEDED = 2,	// the search ran out of budget, the cycle is not proven optimal
+		WINDOW_OPTIMAL = 3		// the cycle is a shortest representative inside its search window
 	};
 
 	enum FileType
 	{
 		IMAGE_DATA = 0,
 		DENSE_DISTANCE_MATRIX = 1,
-		GENERAL_SIMPLICIAL_COMPLEX = 2
+		GENERAL_SIMPLICIAL_COMPLEX = 2,
+		SPARSE_DISTANCE_MATRIX = 3,
+		POINT_CLOUD = 4
 	};
 }
 
@@ -79,7 +127,8 @@ struct cgNode
 	double fScore = 0.0;							// fScore = the length of walked path + the length of estimated remaining path
 	double gScore = 0.0;							// the length of walked path;
 	BitSet sumAnnotation;							// sum of annotations of encountered edges when searching along some path
-	std::vector<std::pair<int, int>> previous;		// used for backtracing the shortest path
+	int parent = -1;								// handle of the node we came from, used for backtracing the shortest path
+	bool isClosed = false;							// whether this node has been expanded
 };
 
 
@@ -90,10 +139,10 @@ struct KeyHasher
 	{
 		size_t res = 17;
 		int first = key.first;
-		int second = key.second.convertBitsToInt();
+		size_t second = key.second.hashValue();
 
 		res = res * 31 + std::hash<int>()(first);
-		res = res * 31 + std::hash<int>()(second);
+		res = res * 31 + second;
 
 		return res;
 	}
@@ -10,14 +10,17 @@ InputFileInfo::InputFileInfo() {
 	verbose			= false;        // turn on/off text outputs
 	input_path		= "";		    // input file path
 	output_path		= "";           // output file path
-	file_type		= 0;			// input file type (0: Image data; 1: Dense distance matrix; 2: sparse distance matrix)
+	file_type		= 0;			// input file type (0: Image data; 1: Dense distance matrix; 2: General simplicial complex; 3: Sparse distance matrix; 4: Point cloud)
 
 	// info for cubical image data
 	dimension = 0;						// the data dimension, exclusively for cubical image data and general simplicial complex
 
-	// info for dense distance matrix
+	// info for dense distance matrix and point cloud
 	numPoints = 0;						// number of points
 	dimPoints = 0;						// dimension of each feature point
+
+	// info for sparse distance matrix
+	numEdges = 0;						// number of edges
 }
 
 void InputFileInfo::source_from_file(const string &input_file_, const string &output_path_) {
@@ -55,6 +58,16 @@ void InputFileInfo::source_from_file(const string &input_file_, const string &ou
 			f >> numPoints;
 			f >> dimPoints;
 		}
+		else if (file_type == 3) // Sparse distance matrix
+		{
+			f >> numPoints;
+			f >> numEdges;
+		}
+		else if (file_type == 4) // Point cloud
+		{
+			f >> numPoints;
+			f >> dimPoints;
+		}
 
 		f.close();
 	}
@@ -85,6 +98,16 @@ void InputFileInfo::source_from_file(const string &input_file_, const string &ou
 			f.read(reinterpret_cast<char*>(&numPoints), sizeof(int));
 			f.read(reinterpret_cast<char*>(&dimPoints), sizeof(int));
 		}
+		else if (file_type == 3) // Sparse distance matrix
+		{
+			f.read(reinterpret_cast<char*>(&numPoints), sizeof(int));
+			f.read(reinterpret_cast<char*>(&numEdges), sizeof(int));
+		}
+		else if (file_type == 4) // Point cloud
+		{
+			f.read(reinterpret_cast<char*>(&numPoints), sizeof(int));
+			f.read(reinterpret_cast<char*>(&dimPoints), sizeof(int));
+		}
 
 		f.close();
 	}
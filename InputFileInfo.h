@@ -19,6 +19,7 @@ public:
 
 	int numPoints;
 	int dimPoints;
+	int numEdges;
 
 	cv::Mat mat;
 
@@ -6,6 +6,7 @@
 #include "DataReaders/DataReaderCubical.h"
 #include "DataReaders/DataReaderFullRips.h"
 #include "DataReaders/DataReaderSimComplex.h"
+#include "DataReaders/DataReaderSparseRips.h"
 #include "PersistenceCalcRunner.h"
 
 template<int dim>
@@ -14,10 +15,7 @@ struct InputRunnerCubical
 	static void run(
 		const InputFileInfo&				 info,
 		double								 pers_thd,
-		vector<vector<vector<vector<int>>>>& final_red_list_grand,
-		vector<vector<vector<vector<int>>>>& final_boundary_list_grand,
-		vector<vector<vector<int>>>&         pers_V,
-		vector<vector<vector<double>>>&      pers_BD
+		PersistenceResult&                 result
 	)
 	{		
 		blitz::Array<double, dim> phi;
@@ -40,7 +38,7 @@ struct InputRunnerCubical
 		}
 
 		PersistenceCalcRunnerCubical<dim> calc;
-		calc.go(&phi, pers_thd, info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		calc.go(&phi, pers_thd, info, result);
 	}
 };
 
@@ -50,13 +48,10 @@ struct InputRunnerFullRips
 	static void run(
 		const InputFileInfo&				 info,
 		double								 pers_thd,
-		vector<vector<vector<vector<int>>>>& final_red_list_grand,
-		vector<vector<vector<vector<int>>>>& final_boundary_list_grand,
-		vector<vector<vector<int>>>&         pers_V,
-		vector<vector<vector<double>>>&      pers_BD
+		PersistenceResult&                 result
 	)
 	{
-		blitz::Array<double, 2> distMatrix;
+		blitz::Array<double, 1> distMatrix; // packed, see DataReaderFullRips
 
 		if (info.binary)
 		{
@@ -70,7 +65,39 @@ struct InputRunnerFullRips
 		}
 
 		PersistenceCalcRunnerFullRips<maxDim> calc;
-		calc.go(&distMatrix, pers_thd, info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		calc.go(&distMatrix, pers_thd, info, result);
+	}
+};
+
+template<int maxDim>
+struct InputRunnerSparseRips
+{
+	static void run(
+		const InputFileInfo&				 info,
+		double								 pers_thd,
+		PersistenceResult&                 result
+	)
+	{
+		blitz::Array<double, 1> values; // filled by the filtration, which reads the edges or the points
+
+		PersistenceCalcRunnerSparseRips<maxDim> calc;
+		calc.go(&values, pers_thd, info, result);
+	}
+};
+
+template<int dim>
+struct InputRunnerAlpha
+{
+	static void run(
+		const InputFileInfo&				 info,
+		double								 pers_thd,
+		PersistenceResult&                 result
+	)
+	{
+		blitz::Array<double, 1> values; // filled by the filtration, which reads the points
+
+		PersistenceCalcRunnerAlpha<dim> calc;
+		calc.go(&values, pers_thd, info, result);
 	}
 };
 
@@ -80,10 +107,7 @@ struct InputRunnerSimComplex
 	static void run(
 		const InputFileInfo&				 info,
 		double								 pers_thd,
-		vector<vector<vector<vector<int>>>>& final_red_list_grand,
-		vector<vector<vector<vector<int>>>>& final_boundary_list_grand,
-		vector<vector<vector<int>>>&         pers_V,
-		vector<vector<vector<double>>>&      pers_BD
+		PersistenceResult&                 result
 	)
 	{
 		blitz::Array<double, 1> pointsVal;
@@ -100,7 +124,7 @@ struct InputRunnerSimComplex
 		}
 
 		PersistenceCalcRunnerSimComplex<dim> calc;
-		calc.go(&pointsVal, pers_thd, info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		calc.go(&pointsVal, pers_thd, info, result);
 	}
 };
 
@@ -113,16 +137,13 @@ struct static_for_InputRunnerFullRips
 	void operator()(
 		int										whichDim,
 		const InputFileInfo&					input_file_info,
-		vector<vector<vector<vector<int>>>>&	final_red_list_grand,
-		vector<vector<vector<vector<int>>>>&	final_boundary_list_grand,
-		vector<vector<vector<int>>>&			pers_V,
-		vector<vector<vector<double>>>&			pers_BD
+		PersistenceResult&					result
 		)
 	{
 		if (whichDim == x)
-			InputRunnerFullRips<2>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerFullRips<2>::run(input_file_info, Globals::reduction_threshold, result);
 
-		static_for_InputRunnerFullRips<x + 1, to>()(whichDim, input_file_info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		static_for_InputRunnerFullRips<x + 1, to>()(whichDim, input_file_info, result);
 	}
 };
 
@@ -132,10 +153,7 @@ struct static_for_InputRunnerFullRips<to, to>
 	void operator()(
 		int									    whichDim,
 		const InputFileInfo&					input_file_info,
-		vector<vector<vector<vector<int>>>>&	final_red_list_grand,
-		vector<vector<vector<vector<int>>>>&	final_boundary_list_grand,
-		vector<vector<vector<int>>>&			pers_V,
-		vector<vector<vector<double>>>&			pers_BD)
+		PersistenceResult&					result)
 	{}
 };
 
@@ -143,10 +161,7 @@ struct static_for_InputRunnerFullRips<to, to>
 // launch persistence homology calculation
 void runPersistenceHomology(
 	const InputFileInfo &                input_file_info,
-	vector<vector<vector<vector<int>>>>& final_red_list_grand,
-	vector<vector<vector<vector<int>>>>& final_boundary_list_grand,
-	vector<vector<vector<int>>>&         pers_V,
-	vector<vector<vector<double>>>&      pers_BD
+	PersistenceResult&                 result
 	)
 {
 	if (input_file_info.dimension > 8 || Globals::max_dim > 8)
@@ -161,28 +176,28 @@ void runPersistenceHomology(
 		switch (input_file_info.dimension) // This is one approach to deal with template compile-time code generation, i.e., use switch
 		{
 		case 1:
-			InputRunnerCubical<1>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<1>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 2:
-			InputRunnerCubical<2>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<2>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 3:
-			InputRunnerCubical<3>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<3>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 4:
-			InputRunnerCubical<4>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<4>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 5:
-			InputRunnerCubical<5>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<5>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 6:
-			InputRunnerCubical<6>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<6>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 7:
-			InputRunnerCubical<7>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<7>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 8:
-			InputRunnerCubical<8>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerCubical<8>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		}
 	}
@@ -191,35 +206,56 @@ void runPersistenceHomology(
 		// This is another approach to dealing with the template inconvenience. 
 		// Note that if the range is too large (e.g., [1 100]), the compilation would take a lot of time.
 		// The following code can deal with dimension from 1 to 8.
-		static_for_InputRunnerFullRips<1, 9>()(Globals::max_dim, input_file_info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		static_for_InputRunnerFullRips<1, 9>()(Globals::max_dim, input_file_info, result);
+	}
+	else if (input_file_info.file_type == Globals::FileType::POINT_CLOUD && Globals::alpha_complex)
+	{
+		// the alpha filtration is built up to the simplices of the dimension of the points
+		switch (input_file_info.dimPoints)
+		{
+		case 2:
+			InputRunnerAlpha<2>::run(input_file_info, Globals::reduction_threshold, result);
+			break;
+		case 3:
+			InputRunnerAlpha<3>::run(input_file_info, Globals::reduction_threshold, result);
+			break;
+		default:
+			std::cerr << "\nThe alpha filtration is only available for points of dimension 2 or 3.\n";
+			exit(EXIT_FAILURE);
+		}
+	}
+	else if (input_file_info.file_type == Globals::FileType::SPARSE_DISTANCE_MATRIX || input_file_info.file_type == Globals::FileType::POINT_CLOUD)
+	{
+		// as for the dense distance matrix, the complex is built up to the triangles
+		InputRunnerSparseRips<2>::run(input_file_info, Globals::reduction_threshold, result);
 	}
 	else if (input_file_info.file_type == Globals::FileType::GENERAL_SIMPLICIAL_COMPLEX)
 	{
 		switch (input_file_info.dimension)
 		{
 		case 1:
-			InputRunnerSimComplex<1>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<1>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 2:
-			InputRunnerSimComplex<2>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<2>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 3:
-			InputRunnerSimComplex<3>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<3>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 4:
-			InputRunnerSimComplex<4>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<4>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 5:
-			InputRunnerSimComplex<5>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<5>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 6:
-			InputRunnerSimComplex<6>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<6>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 7:
-			InputRunnerSimComplex<7>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<7>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		case 8:
-			InputRunnerSimComplex<8>::run(input_file_info, Globals::reduction_threshold, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+			InputRunnerSimComplex<8>::run(input_file_info, Globals::reduction_threshold, result);
 			break;
 		}
 	}
@@ -21,9 +21,21 @@ void parseCommandLine(int argc, const char* argv[])
 
 	OptionGroup optionals(Policy::optional, "Optional Parameters");
 	optionals.addOption("-t", "Threshold", "--threshold");
-	optionals.addOption("-a", "Algorithm to apply: A* Search (0) or Exhaustive Search (1)", "--algorithm");
+	optionals.addOption("-a", "Algorithm to apply: A* Search (0), Exhaustive Search (1), automatic choice per class (2) or bidirectional A* Search (3)", "--algorithm");
 	optionals.addOption("-d", "Maximum dimension to be computed", "--dimension");
 	optionals.addOption("-p", "Number of threads", "--pthread");
+	optionals.addOption("-k", "Number of annotation bits per pattern database of A* heuristic", "--pattern");
+	optionals.addOption("-m", "Memory budget (MB) for the pattern databases", "--pattern_memory");
+	optionals.addOption("-s", "Seed for the spanning forest of edge annotations", "--seed");
+	optionals.addOption("-n", "Budget of expanded nodes per homology class (0: unlimited)", "--max_nodes");
+	optionals.addOption("-b", "Memory budget (MB) of the search per homology class (0: unlimited)", "--max_memory");
+	optionals.addOption("-l", "Time limit (s) of the search per homology class (0: unlimited)", "--time_limit");
+	optionals.addOption("-w", "Search optimal cycles of images within this halo around the reduced cycle (0: whole image)", "--window");
+	optionals.addOption("-r", "Maximal diameter of the Rips simplices (default: the enclosing radius of the points, or all the edges of a sparse distance matrix); the classes alive at it are saved as dying at inf", "--rips_threshold");
+	optionals.addOption("-e", "Exponent of the Minkowski distance between the points of a point cloud (default: 2, Euclidean; inf: Chebyshev)", "--minkowski");
+	optionals.addOption("-x", "Approximate the Rips filtration of a point cloud by a sparse one, within a factor 1 / (1 - epsilon) (0 < epsilon < 1)", "--approximation");
+	optionals.addOption("-g", "Use the alpha filtration of a point cloud of dimension 2 or 3 instead of the Rips filtration", "--alpha");
+	optionals.addOption("-c", "Collapse the dominated edges of a Rips filtration before building its simplices (same diagram, but the cycles are not optimal)", "--edge_collapse");
 	optionals.addOption("-h", "Show info and usage", "--help");
 	cmd.addOptionGroup(optionals);
 
@@ -67,9 +79,9 @@ void parseCommandLine(int argc, const char* argv[])
 		Globals::which_alg = stoi(temp_alg);
 		Globals::use_optimal_alg = true;
 
-		if (Globals::which_alg >= 2)
+		if (Globals::which_alg >= 4)
 		{
-			cout << "The algorithm index should be 0 (A* Search) or 1 (Exhaustive Search)." << endl;
+			cout << "The algorithm index should be 0 (A* Search), 1 (Exhaustive Search), 2 (Automatic) or 3 (Bidirectional A* Search)." << endl;
 			exit(EXIT_FAILURE);
 		}
 	}
@@ -98,6 +110,146 @@ void parseCommandLine(int argc, const char* argv[])
 		Globals::num_threads = stoi(temp_num_thread);
 	}
 
+	if (cmd.optionExists("-k") || cmd.optionExists("--pattern"))
+	{
+		std::string temp_pattern = cmd.getParameter("-k") + cmd.getParameter("--pattern");
+		if (temp_pattern.empty())
+		{
+			cerr << "Error: please specify the number of bits per pattern database." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::pattern_size = stoi(temp_pattern);
+	}
+
+	if (cmd.optionExists("-m") || cmd.optionExists("--pattern_memory"))
+	{
+		std::string temp_memory = cmd.getParameter("-m") + cmd.getParameter("--pattern_memory");
+		if (temp_memory.empty())
+		{
+			cerr << "Error: please specify the memory budget for pattern databases." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::pattern_memory = stoi(temp_memory);
+	}
+
+	if (cmd.optionExists("-s") || cmd.optionExists("--seed"))
+	{
+		std::string temp_seed = cmd.getParameter("-s") + cmd.getParameter("--seed");
+		if (temp_seed.empty())
+		{
+			cerr << "Error: please specify the seed." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::spanning_tree_seed = stoul(temp_seed);
+	}
+
+	if (cmd.optionExists("-n") || cmd.optionExists("--max_nodes"))
+	{
+		std::string temp_nodes = cmd.getParameter("-n") + cmd.getParameter("--max_nodes");
+		if (temp_nodes.empty())
+		{
+			cerr << "Error: please specify the budget of expanded nodes." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::max_expanded_nodes = stoll(temp_nodes);
+	}
+
+	if (cmd.optionExists("-b") || cmd.optionExists("--max_memory"))
+	{
+		std::string temp_memory = cmd.getParameter("-b") + cmd.getParameter("--max_memory");
+		if (temp_memory.empty())
+		{
+			cerr << "Error: please specify the memory budget of the search." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::max_search_memory = stoi(temp_memory);
+	}
+
+	if (cmd.optionExists("-l") || cmd.optionExists("--time_limit"))
+	{
+		std::string temp_time = cmd.getParameter("-l") + cmd.getParameter("--time_limit");
+		if (temp_time.empty())
+		{
+			cerr << "Error: please specify the time limit of the search." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::max_search_time = stod(temp_time);
+	}
+
+	if (cmd.optionExists("-w") || cmd.optionExists("--window"))
+	{
+		std::string temp_window = cmd.getParameter("-w") + cmd.getParameter("--window");
+		if (temp_window.empty())
+		{
+			cerr << "Error: please specify the halo of the search window." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::search_window = stoi(temp_window);
+	}
+
+	if (cmd.optionExists("-r") || cmd.optionExists("--rips_threshold"))
+	{
+		std::string temp_rips = cmd.getParameter("-r") + cmd.getParameter("--rips_threshold");
+		if (temp_rips.empty())
+		{
+			cerr << "Error: please specify the maximal diameter of the Rips simplices." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::rips_threshold = stod(temp_rips);
+	}
+
+	if (cmd.optionExists("-e") || cmd.optionExists("--minkowski"))
+	{
+		std::string temp_minkowski = cmd.getParameter("-e") + cmd.getParameter("--minkowski");
+		if (temp_minkowski.empty())
+		{
+			cerr << "Error: please specify the exponent of the Minkowski distance." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::minkowski_p = stod(temp_minkowski);
+		if (!(Globals::minkowski_p >= 1))
+		{
+			cerr << "Error: the exponent of the Minkowski distance must be at least 1." << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (cmd.optionExists("-x") || cmd.optionExists("--approximation"))
+	{
+		std::string temp_epsilon = cmd.getParameter("-x") + cmd.getParameter("--approximation");
+		if (temp_epsilon.empty())
+		{
+			cerr << "Error: please specify the epsilon of the sparse Rips filtration." << endl;
+			cmd.printHelpMessage("USAGE:");
+			exit(EXIT_FAILURE);
+		}
+		Globals::rips_epsilon = stod(temp_epsilon);
+		if (!(Globals::rips_epsilon > 0 && Globals::rips_epsilon < 1))
+		{
+			cerr << "Error: the epsilon of the sparse Rips filtration must be between 0 and 1." << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (cmd.optionExists("-g") || cmd.optionExists("--alpha"))
+	{
+		Globals::alpha_complex = true;
+	}
+
+	if (cmd.optionExists("-c") || cmd.optionExists("--edge_collapse"))
+	{
+		Globals::edge_collapse = true;
+	}
+
 	summary();
 }
 
@@ -105,6 +257,16 @@ void summary()
 {
 	cout << "+++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
 	cout << "Input data file:  " << Globals::inputFileName << endl;
+	if (Globals::rips_threshold >= 0)
+		cout << "Rips threshold:  " << Globals::rips_threshold << endl;
+	if (Globals::minkowski_p != 2)
+		cout << "Minkowski exponent:  " << Globals::minkowski_p << endl;
+	if (Globals::rips_epsilon > 0)
+		cout << "Sparse Rips epsilon:  " << Globals::rips_epsilon << endl;
+	if (Globals::alpha_complex)
+		cout << "Alpha filtration:  Yes" << endl;
+	if (Globals::edge_collapse)
+		cout << "Edge collapse:  Yes" << endl;
 
 	cout << "Use use optimal cycle algorithm:  ";
 	if (Globals::use_optimal_alg == false)
@@ -122,6 +284,12 @@ void summary()
 		case Globals::Algorithm::CLASSICAL_ALG:
 			cout << "Classical Annotation Algorithm (Exhaustive Search)" << endl;
 			break;
+		case Globals::Algorithm::AUTO_ALG:
+			cout << "Automatic Selection between Heuristic-based and Classical Algorithm" << endl;
+			break;
+		case Globals::Algorithm::BIDIRECTIONAL_ALG:
+			cout << "Heuristic-based Algorithm (Bidirectional)" << endl;
+			break;
 		default:
 			cout << "Unexpected parameter for algorithm selection!" << endl;
 			exit(EXIT_FAILURE);
@@ -130,6 +298,13 @@ void summary()
 
 		cout << "Threshold:  " << Globals::reduction_threshold << endl;
 		cout << "Number of threads: " << Globals::num_threads << endl;
+		if (Globals::which_alg != Globals::Algorithm::CLASSICAL_ALG)
+			cout << "Pattern database:  " << Globals::pattern_size << " bits, " << Globals::pattern_memory << " MB" << endl;
+		if (Globals::max_expanded_nodes > 0 || Globals::max_search_memory > 0 || Globals::max_search_time > 0)
+			cout << "Search budget:  " << Globals::max_expanded_nodes << " nodes, " << Globals::max_search_memory << " MB, "
+				<< Globals::max_search_time << " s (0: unlimited)" << endl;
+		if (Globals::search_window > 0)
+			cout << "Search window:  " << Globals::search_window << " pixels around the reduced cycle" << endl;
 	}
 	cout << "+++++++++++++++++++++++++++++++++++++++++++++++++" << endl << endl;
 }
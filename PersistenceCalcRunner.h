@@ -6,6 +6,8 @@
 #include "Filtration/CubicalFiltration.h"
 #include "Filtration/FullRipsFiltration.h"
 #include "Filtration/SimComplexFiltration.h"
+#include "Filtration/SparseRipsFiltration.h"
+#include "Filtration/AlphaFiltration.h"
 
 template<int dim>
 struct PersistenceCalcRunnerCubical
@@ -17,10 +19,7 @@ struct PersistenceCalcRunnerCubical
 		blitz::Array<double, dim> *phi,
 		double pers_thd,
 		const InputFileInfo &info,
-		vector<vector<vector<vector<int>>>>& final_red_list_grand,
-		vector<vector<vector<vector<int>>>>& final_boundary_list_grand,
-		vector<vector<vector<int>>>&         pers_V,
-		vector<vector<vector<double>>>&      pers_BD
+		PersistenceResult&                 result
 		)
 	{	
 		PersistenceCalculator<dim> calc;
@@ -28,7 +27,7 @@ struct PersistenceCalcRunnerCubical
 
 		vector<Vertex> vList;
 
-		calc.calcPersistence(phi, pers_thd, res, vList, info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		calc.calcPersistence(phi, pers_thd, res, vList, info, result);
 
 		//// local scope
 		//{
@@ -57,25 +56,22 @@ struct PersistenceCalcRunnerCubical
 template<int dim>
 struct PersistenceCalcRunnerFullRips
 {
-	typedef blitz::TinyVector<int, 2> Vertex;
+	typedef blitz::TinyVector<int, 1> Vertex;
 	typedef vector<PersPair<Vertex>> PersResultContainer;
 
 	void go(
-		blitz::Array<double, 2>*				distMatrix,
+		blitz::Array<double, 1>*				distMatrix,
 		double									pers_thd,
 		const InputFileInfo&					info,
-		vector<vector<vector<vector<int>>>>&	final_red_list_grand,
-		vector<vector<vector<vector<int>>>>&	final_boundary_list_grand,
-		vector<vector<vector<int>>>&			pers_V,
-		vector<vector<vector<double>>>&			pers_BD
+		PersistenceResult&					result
 	)
 	{
-		PersistenceCalculator<dim, 2, 2, FullRipsFiltration<dim>, 1> calc;
+		PersistenceCalculator<dim, 1, 1, FullRipsFiltration<dim>, 1> calc;
 		vector<PersResultContainer> res(dim);
 
-		vector<Vertex> vList;
+		typename FullRipsFiltration<dim>::VertexList vList; // implicit: vertex v is the packed entry v
 
-		calc.calcPersistence(distMatrix, pers_thd, res, vList, info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		calc.calcPersistence(distMatrix, pers_thd, res, vList, info, result);
 
 		//// local scope
 		//{
@@ -88,7 +84,7 @@ struct PersistenceCalcRunnerFullRips
 		//}
 
 		//{
-		//	BinaryPersistentPairsSaver<dim, 2, 2> binSaver;
+		//	BinaryPersistentPairsSaver<dim, 1, 1> binSaver;
 
 		//	stringstream output_file;
 		//	output_file << info.input_path;
@@ -110,10 +106,7 @@ struct PersistenceCalcRunnerSimComplex
 		blitz::Array<double, 1>*				pointsVal,
 		double									pers_thd,
 		const InputFileInfo&					info,
-		vector<vector<vector<vector<int>>>>&	final_red_list_grand,
-		vector<vector<vector<vector<int>>>>&	final_boundary_list_grand,
-		vector<vector<vector<int>>>&			pers_V,
-		vector<vector<vector<double>>>&			pers_BD
+		PersistenceResult&					result
 	)
 	{
 		PersistenceCalculator<dim, 1, 1, SimComplexFiltration<dim>, 2> calc;
@@ -121,7 +114,7 @@ struct PersistenceCalcRunnerSimComplex
 
 		vector<Vertex> vList;
 
-		calc.calcPersistence(pointsVal, pers_thd, res, vList, info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+		calc.calcPersistence(pointsVal, pers_thd, res, vList, info, result);
 
 		//// local scope
 		//{
@@ -145,4 +138,48 @@ struct PersistenceCalcRunnerSimComplex
 	}
 };
 
+template<int dim>
+struct PersistenceCalcRunnerSparseRips
+{
+	typedef blitz::TinyVector<int, 1> Vertex;
+	typedef vector<PersPair<Vertex>> PersResultContainer;
+
+	void go(
+		blitz::Array<double, 1>*				values,
+		double									pers_thd,
+		const InputFileInfo&					info,
+		PersistenceResult&					result
+	)
+	{
+		PersistenceCalculator<dim, 1, 1, SparseRipsFiltration<dim>, 1> calc;
+		vector<PersResultContainer> res(dim);
+
+		typename SparseRipsFiltration<dim>::VertexList vList; // implicit: vertex v is the value entry v
+
+		calc.calcPersistence(values, pers_thd, res, vList, info, result);
+	}
+};
+
+template<int dim>
+struct PersistenceCalcRunnerAlpha
+{
+	typedef blitz::TinyVector<int, 1> Vertex;
+	typedef vector<PersPair<Vertex>> PersResultContainer;
+
+	void go(
+		blitz::Array<double, 1>*				values,
+		double									pers_thd,
+		const InputFileInfo&					info,
+		PersistenceResult&					result
+	)
+	{
+		PersistenceCalculator<dim, 1, 1, AlphaFiltration<dim>, 1> calc;
+		vector<PersResultContainer> res(dim);
+
+		typename AlphaFiltration<dim>::VertexList vList; // implicit: vertex v is the value entry v
+
+		calc.calcPersistence(values, pers_thd, res, vList, info, result);
+	}
+};
+
 #endif
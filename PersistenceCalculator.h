@@ -6,12 +6,14 @@
 // to be cleared, and clear them once we have calculated the matrix.
 // We need to store only one matrix at a time.
 #include <ctime>
+#include <limits>
 #include "Algorithms/Reduction.h"
 #include "Algorithms/AnnotatingEdges.h"
 #include "Algorithms/AStar.h"
 #include "BitSet.h"
 #include "Globals.h"
 #include "Algorithms/ExhaustiveSearch.h"
+#include "Algorithms/AlgorithmSelection.h"
 #include "Filtration/FullRipsFiltration.h"
 #include "Filtration/CubicalFiltration.h"
 #include "Filtration/SimComplexFiltration.h"
@@ -26,17 +28,17 @@ struct PersistenceCalculator
 {
 	typedef blitz::TinyVector<int, vertexDim> Vertex;
 	typedef vector<PersPair<Vertex> > PersResultContainer;
+	typedef typename FiltrationGeneratorType::VertexList VertexList;
 
 	// -- Save persistence infomation
-	template<typename NDArray>
-	void SavePersistence(NDArray * phi, const vector<Vertex> &vList, vector< int > & lowerCellList,	vector< int > & upperCellList, 
-		vector< int > & low_array, const double pers_thd, PersResultContainer &veList,
-		/* for reduction list*/
-		vector< MatrixListType > & red_list, vector< MatrixListType > & red_cell2v_list, 	vector< MatrixListType > & final_red_list,
-		vector< MatrixListType > & bd_list, 	vector< MatrixListType > & bd_cell2v_list, vector< MatrixListType > & final_boundary_list)
+	template<typename NDArray, typename VertexListT>
+	void SavePersistence(NDArray * phi, const VertexListT &vList, vector< int > & lowerCellList,	vector< int > & upperCellList, 
+		vector< int > & low_array, const double pers_thd, PersResultContainer &veList, vector< int > & saved_columns,
+		/* for the optimization status of the boundary lists*/
+		const vector< int > & cycle_status, vector< int > & final_status_list)
 	{
-		assert(final_red_list.empty());
-		assert(final_boundary_list.empty());
+		assert(saved_columns.empty());
+		assert(final_status_list.empty());
 
 		// output vertex-edge pairs whose persistence is bigger than pers_thd
 		for (int i = 0; i < lowerCellList.size(); i++)
@@ -57,25 +59,107 @@ struct PersistenceCalculator
 			if (tmp_pers > pers_thd) 
 			{
 				veList.push_back(PersPair<Vertex>(vList[vBirth],	vList[vDeath], tmp_pers, tmp_birth, tmp_death));		
+				saved_columns.push_back(tmp_int); // the column of the pair, in the order of veList
+				final_status_list.push_back(cycle_status.empty() ? Globals::CycleStatus::NOT_OPTIMIZED : cycle_status[tmp_int]);
+			}
+		}
+	}
 
-				// save the reduction lists
-				MatrixListType tmp_list;
-				assert(!red_list[tmp_int].empty());
-				for (MatrixListType::iterator tmpiter = red_list[tmp_int].begin(); tmpiter != red_list[tmp_int].end(); tmpiter++) 
-				{
-					tmp_list = list_union(tmp_list, red_cell2v_list[*tmpiter]);
-				}
-				final_red_list.push_back(tmp_list);
+	// -- Save the classes of dimension d that never die: the positive d-cells (whose columns are reduced to zero) which are
+	// not the pivot of any column of dimension d + 1. This happens when the filtration does not fill up the space, e.g., a
+	// Rips filtration truncated below the enclosing radius. They are saved as pairs dying at infinity (with the birth vertex
+	// as death vertex), with their cycles (their reduction lists) as boundary lists and empty reduction lists.
+	// For d = 0, boundary and reduction_list are empty and the cycle of a vertex is the vertex itself; the first vertex is
+	// left out, since its component is the whole space in any filtration.
+	template<typename NDArray, typename VertexListT>
+	void SaveEssentialClasses(NDArray * phi, const VertexListT &vList, int d, const vector< int > & cellList, const vector< int > & low_array,
+		const vector< MatrixListType > & boundary, const vector< MatrixListType > & reduction_list, const vector< MatrixListType > & cell2v_list,
+		PersResultContainer &veList, vector< int > & final_status_list, CycleList & final_reduction_list, CycleList & final_boundary_list,
+		PersistenceResult & result, vector< char > & used_vertex)
+	{
+		vector< MatrixListType > cycles; // the d-cells of the cycle of each class
+		for (int i = (d == 0) ? 1 : 0; i < cellList.size(); i++)
+		{
+			if (low_array[i] != Globals::BIG_INT)
+				continue;
+			if (d > 0 && (!boundary[i].empty() || reduction_list[i].empty())) // a negative cell
+				continue;
+
+			double tmp_birth = (*phi)(vList[cellList[i]]);
+			double tmp_death = std::numeric_limits<double>::infinity();
+			veList.push_back(PersPair<Vertex>(vList[cellList[i]], vList[cellList[i]], tmp_death, tmp_birth, tmp_death));
+			cycles.push_back((d == 0) ? MatrixListType(1, i) : reduction_list[i]);
+			final_status_list.push_back(Globals::CycleStatus::NOT_OPTIMIZED);
+		}
+
+		vector< int > columns(cycles.size());
+		for (int k = 0; k < columns.size(); k++)
+			columns[k] = k;
+		if (result.lazy)
+		{
+			SaveChains(columns, cycles, cell2v_list, result.boundaryChains[d], used_vertex);
+			for (int k = 0; k < columns.size(); k++)
+				result.reductionChains[d].chains.addCycle(); // no (d + 1)-chain kills the class
+		}
+		else
+		{
+			SaveCycles(columns, cycles, cell2v_list, final_boundary_list);
+			for (int k = 0; k < columns.size(); k++)
+				final_reduction_list.addCycle();
+		}
+	}
+
+	// -- Save the reduction (or boundary) lists of the saved pairs, i.e., the vertices of their cells, appending them to
+	// the last dimension of final_list.
+	// The pairs are independent, so they are split into ranges which are built in parallel, each into its own buffer.
+	void SaveCycles(const vector< int > & saved_columns, const vector< MatrixListType > & chain_list,
+		const vector< MatrixListType > & cell2v_list, CycleList & final_list)
+	{
+		assert(final_list.numDims() == 1 && final_list.coordDim == 1);
+
+		int numRanges = std::min((int)saved_columns.size(), 8 * getThreadPool().size());
+		vector< CycleList > ranges(numRanges, CycleList(1));
+		getThreadPool().run(numRanges, [&](int r, int) {
+			size_t first = saved_columns.size() * r / numRanges;
+			size_t last = saved_columns.size() * (r + 1) / numRanges;
+			ranges[r].addDimension();
+			for (size_t k = first; k < last; k++)
+			{
+				assert(!chain_list[saved_columns[k]].empty());
+				list_union_k(chain_list[saved_columns[k]], cell2v_list, ranges[r].coords);
+				ranges[r].addCycle();
+			}
+		});
+
+		for (int r = 0; r < numRanges; r++)
+			final_list.append(ranges[r]);
+	}
 
-				// save the boundary lists
-				MatrixListType tmp_boundary_list;
-				assert(!bd_list[tmp_int].empty());
-				for (MatrixListType::iterator tmpiter = bd_list[tmp_int].begin(); tmpiter != bd_list[tmp_int].end(); tmpiter++) 
+	// -- Save the reduction (or boundary) lists of the saved pairs in compact form, i.e., the columns and the
+	// cells used by them, so that the vertex lists can be built later for the requested pairs only
+	void SaveChains(const vector< int > & saved_columns, const vector< MatrixListType > & chain_list,
+		const vector< MatrixListType > & cell2v_list, ChainList & final_chains, vector< char > & used_vertex)
+	{
+		vector< int > cell_index(cell2v_list.size(), -1); // cell -> its index in final_chains.cells
+		for (size_t k = 0; k < saved_columns.size(); k++)
+		{
+			const MatrixListType & column = chain_list[saved_columns[k]];
+			assert(!column.empty());
+			for (MatrixListType::const_iterator cell = column.begin(); cell != column.end(); cell++)
+			{
+				if (cell_index[*cell] == -1)
 				{
-					tmp_boundary_list = list_union(tmp_boundary_list, bd_cell2v_list[*tmpiter]);
+					cell_index[*cell] = final_chains.cells.numCycles();
+					for (MatrixListType::const_iterator v = cell2v_list[*cell].begin(); v != cell2v_list[*cell].end(); v++)
+					{
+						final_chains.cells.coords.push_back(*v);
+						used_vertex[*v] = 1;
+					}
+					final_chains.cells.addCycle();
 				}
-				final_boundary_list.push_back(tmp_boundary_list);
+				final_chains.chains.coords.push_back(cell_index[*cell]);
 			}
+			final_chains.chains.addCycle();
 		}
 	}
 
@@ -85,25 +169,28 @@ struct PersistenceCalculator
 		blitz::Array<double, arrayDim>*			phi,
 		const double							pers_thd,
 		vector<PersResultContainer>&			result_lists,
-		vector<Vertex>&							_vList,
+		VertexList&								_vList,
 		const InputFileInfo&					info,
-		vector<vector<vector<vector<int>>>>&	final_red_list_grand,
-		vector<vector<vector<vector<int>>>>&	final_boundary_list_grand,
-		vector<vector<vector<int>>>&			pers_V,
-		vector<vector<vector<double>>>&			pers_BD
+		PersistenceResult&						result
 	)
 	{
 		time_t wholestart, wholeend, redstart, redend;
 		double wholetime = 0, redtime = 0;
 
 		// ===== To return the reduction and boundary results =====
-		final_red_list_grand.resize(dim);
-		final_boundary_list_grand.resize(dim);
-		pers_V.resize(dim);
-		pers_BD.resize(dim);
+		result.clear();
+		result.reductions.coordDim = dim;
+		result.boundaries.coordDim = dim;
+		result.pairs.coordDim = dim;
+		result.lazy = Globals::lazy_representatives;
+		if (result.lazy)
+		{
+			result.reductionChains.resize(dim);
+			result.boundaryChains.resize(dim);
+		}
 
 		time(&wholestart);
-		vector<Vertex> *vList = &_vList;
+		VertexList *vList = &_vList;
 
 		birth_lists.assign(dim + 1, vector<int>());
 		cell2v_lists.assign(dim + 1, vector<MatrixListType>());
@@ -114,6 +201,7 @@ struct PersistenceCalculator
 		// initialize vertex lists, birth_lists, and cell2v_lists
 		FiltrationGeneratorType filtration(phi, info);
 		filtration.init(vList);
+		result.pairs.approximationFactor = filtration.approximationFactor();
 
 		assert(!vList->empty());
 		for (int i = 0; i <= dim; i++)
@@ -133,8 +221,19 @@ struct PersistenceCalculator
 
 		// save for each negative simplex the simplices used to reduce it
 		vector< MatrixListType > reduction_list;
-		vector< MatrixListType > final_reduction_list;
-		vector< MatrixListType > final_boundary_list;
+		vector< int > cycle_status; // the Globals::CycleStatus of each column of the boundary matrix
+
+		// the saved cycles (as vertex indices) and their status, per dimension; the dimensions
+		// are computed from the top, so they are only converted to coordinates at the end
+		vector< CycleList > final_reduction_lists(dim, CycleList(1));
+		vector< CycleList > final_boundary_lists(dim, CycleList(1));
+		vector< vector< int > > final_status_lists(dim);
+		for (int i = 0; i < dim; i++)
+		{
+			final_reduction_lists[i].addDimension();
+			final_boundary_lists[i].addDimension();
+		}
+		vector< char > used_vertex(result.lazy ? vList->size() : 0, 0); // the vertices used by the compact chains
 
 
 		for (int d = dim; d >= 1; d--)
@@ -152,18 +251,27 @@ struct PersistenceCalculator
 			{
 				std::map<std::pair<int, int>, int> edgeMap;
 				constructMap_Edge2Ptr(edgeMap, cell2v_lists[d - 1]);
+				cycle_status.assign(boundaries[d].size(), Globals::CycleStatus::NOT_OPTIMIZED);
+				int windowHalo = (type == 0) ? Globals::search_window : 0; // search windows need the pixel coordinates of images
 
 				switch (Globals::which_alg)
 				{
 				case Globals::Algorithm::HEURISTIC_BASED_ALG:
-					reduceND_AStar<arrayDim, vertexDim>(phi, *vList, birth_lists[d - 1], birth_lists[d], boundaries[d], edgeMap, cell2v_lists[d - 1], sizes[0], low_arrays[d]);
+				case Globals::Algorithm::BIDIRECTIONAL_ALG:
+					reduceND_AStar<arrayDim, vertexDim>(phi, *vList, birth_lists[d - 1], birth_lists[d], boundaries[d], edgeMap, cell2v_lists[d - 1], sizes[0], low_arrays[d], cycle_status, windowHalo);
 					break;
 				case Globals::Algorithm::CLASSICAL_ALG:
-					reduceND_ExhaustiveSearch<arrayDim, vertexDim>(phi, *vList, birth_lists[d - 1], birth_lists[d], boundaries[d], edgeMap, cell2v_lists[d - 1], sizes[0], low_arrays[d]);
+					reduceND_ExhaustiveSearch<arrayDim, vertexDim>(phi, *vList, birth_lists[d - 1], birth_lists[d], boundaries[d], edgeMap, cell2v_lists[d - 1], sizes[0], low_arrays[d], cycle_status, windowHalo);
+					break;
+				case Globals::Algorithm::AUTO_ALG:
+					reduceND_Auto<arrayDim, vertexDim>(phi, *vList, birth_lists[d - 1], birth_lists[d], boundaries[d], edgeMap, cell2v_lists[d - 1], sizes[0], low_arrays[d], cycle_status, windowHalo);
 					break;
 				default:
 					break;
 				}
+
+				if (!filtration.hasOptimalCycles()) // the cycles were searched in a smaller complex
+					cycle_status.assign(boundaries[d].size(), Globals::CycleStatus::NOT_OPTIMIZED);
 			}// end if
 
 			time(&redend);
@@ -171,18 +279,28 @@ struct PersistenceCalculator
 			if (info.verbose) cout << "Reduced dimension " << d << endl;
 
 			// save persistence, boundaries, red_list for this dimension, such that the memory could be cleaned
-			SavePersistence(phi, *vList, birth_lists[d - 1], birth_lists[d], low_arrays[d], pers_thd, result_lists[d - 1],
-				reduction_list, cell2v_lists[d], final_reduction_list, boundaries[d], cell2v_lists[d - 1], final_boundary_list);
+			vector< int > saved_columns;
+			SavePersistence(phi, *vList, birth_lists[d - 1], birth_lists[d], low_arrays[d], pers_thd, result_lists[d - 1], saved_columns,
+				cycle_status, final_status_lists[d - 1]);
+			if (result.lazy)
+			{
+				SaveChains(saved_columns, reduction_list, cell2v_lists[d], result.reductionChains[d - 1], used_vertex);
+				SaveChains(saved_columns, boundaries[d], cell2v_lists[d - 1], result.boundaryChains[d - 1], used_vertex);
+			}
+			else
+			{
+				SaveCycles(saved_columns, reduction_list, cell2v_lists[d], final_reduction_lists[d - 1]);
+				SaveCycles(saved_columns, boundaries[d], cell2v_lists[d - 1], final_boundary_lists[d - 1]);
+			}
+
+			// the pairs of dimension d have been saved with dimension d + 1; add the classes that never die, whose cycles are now known
+			if (d < dim)
+				SaveEssentialClasses(phi, *vList, d, birth_lists[d], low_arrays[d + 1], boundaries[d], reduction_list, cell2v_lists[d],
+					result_lists[d], final_status_lists[d], final_reduction_lists[d], final_boundary_lists[d], result, used_vertex);
 			
 			// release memory
 			cell2v_lists[d].clear();
 
-			// save reduction and boundary files
-			BinaryPersistentPairsSaver<dim, arrayDim, vertexDim> binSaver;
-			binSaver.index2coord(final_reduction_list, (*vList), final_red_list_grand[d - 1]);
-			binSaver.index2coord(final_boundary_list, (*vList), final_boundary_list_grand[d - 1]);
-			binSaver.pers2vector(result_lists[d - 1], pers_V[d - 1], pers_BD[d - 1]);
-
 			//stringstream output_red_file;
 			//output_red_file << info.input_path;
 			//output_red_file << ".red." << d;
@@ -196,11 +314,32 @@ struct PersistenceCalculator
 			//cout << "Saved dimension " << d << endl << endl;
 
 			reduction_list.clear();
-			final_reduction_list.clear();
 			boundaries[d].clear();
-			final_boundary_list.clear();
+			cycle_status.clear();
 		}// end for
 
+		// the components that never die
+		SaveEssentialClasses(phi, *vList, 0, birth_lists[0], low_arrays[1], vector< MatrixListType >(), vector< MatrixListType >(), cell2v_lists[0],
+			result_lists[0], final_status_lists[0], final_reduction_lists[0], final_boundary_lists[0], result, used_vertex);
+
+		// save reduction and boundary results in the order of dimensions
+		BinaryPersistentPairsSaver<dim, arrayDim, vertexDim> binSaver;
+		if (result.lazy) // only keep the coordinates of the vertices used by the chains
+			binSaver.compactVertices((*vList), used_vertex, result.reductionChains, result.boundaryChains, result.vertexCoords);
+		for (int i = 0; i < dim; i++)
+		{
+			if (!result.lazy)
+			{
+				binSaver.index2coord(final_reduction_lists[i], (*vList), result.reductions);
+				binSaver.index2coord(final_boundary_lists[i], (*vList), result.boundaries);
+			}
+			binSaver.pers2vector(result_lists[i], (*vList), result.pairs);
+			result.status.insert(result.status.end(), final_status_lists[i].begin(), final_status_lists[i].end());
+
+			final_reduction_lists[i].clear();
+			final_boundary_lists[i].clear();
+		}
+
 		time(&wholeend);
 		wholetime = difftime(wholeend, wholestart);
 
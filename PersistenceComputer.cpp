@@ -47,7 +47,7 @@ double Persistence_Computer::run() {
 	time_t startTime, endTime;
 	if (debug_enabled) debugStart(debug_path);
 	time(&startTime);
-	runPersistenceHomology(file_info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+	runPersistenceHomology(file_info, result);
 	time(&endTime);
 	double ellapsed1 = difftime(endTime, startTime);
 	if (debug_enabled) debugEnd();
@@ -86,8 +86,8 @@ void Persistence_Computer::set_pers_thd(double t) {
 	Globals::use_optimal_alg = true;
 }
 void Persistence_Computer::set_algorithm(int t) {
-	if (t >= 2 || t < 0) {
-		cout << "0 for A* search; 1 for exhaustive search ..."; exit(1);
+	if (t >= 4 || t < 0) {
+		cout << "0 for A* search; 1 for exhaustive search; 2 for automatic choice; 3 for bidirectional A* search ..."; exit(1);
 	}
 	Globals::which_alg = t; Globals::use_optimal_alg = true;
 }
@@ -95,50 +95,138 @@ void Persistence_Computer::set_algorithm(int t) {
 void Persistence_Computer::set_output_file(const string& t) { file_info.output_path = t; }
 void Persistence_Computer::set_max_dim(int t) { Globals::max_dim = t; }
 void Persistence_Computer::set_num_threads(int t) { Globals::num_threads = t; }
+void Persistence_Computer::set_pattern_database(int bits, int memory_mb) { Globals::pattern_size = bits; Globals::pattern_memory = memory_mb; }
+void Persistence_Computer::set_spanning_tree_seed(unsigned int seed) { Globals::spanning_tree_seed = seed; }
+void Persistence_Computer::set_search_budget(long long max_nodes, int max_memory_mb, double max_seconds) {
+	Globals::max_expanded_nodes = max_nodes; Globals::max_search_memory = max_memory_mb; Globals::max_search_time = max_seconds;
+}
+void Persistence_Computer::set_search_window(int halo) { Globals::search_window = halo; }
+void Persistence_Computer::set_rips_threshold(double t) { Globals::rips_threshold = t; }
+void Persistence_Computer::set_minkowski_p(double t) { Globals::minkowski_p = t; }
+void Persistence_Computer::set_rips_approximation(double epsilon) { Globals::rips_epsilon = epsilon; }
+void Persistence_Computer::set_alpha_complex(bool t) { Globals::alpha_complex = t; }
+void Persistence_Computer::set_edge_collapse(bool t) { Globals::edge_collapse = t; }
+void Persistence_Computer::set_lazy_representatives(bool t) { Globals::lazy_representatives = t; }
 void Persistence_Computer::set_verbose(bool t) { file_info.verbose = t; }
 void Persistence_Computer::set_debug(bool t, const string& debug_path_) { debug_enabled = t; debug_path = debug_path_; }
 
-void Persistence_Computer::write_bnd(const vector<vector<vector<vector<int>>>>& t) {
+void Persistence_Computer::write_bnd(const CycleList& t) {
 	string output_bnd_file = output_name + ".bnd";
 	BinaryPersistentPairsSaver<1>::write_BNDorRED(t, output_bnd_file.c_str());
 }
 
-void Persistence_Computer::write_red(const vector<vector<vector<vector<int>>>>& t) {
+void Persistence_Computer::write_red(const CycleList& t) {
 	string output_red_file = output_name + ".red";
 	BinaryPersistentPairsSaver<1>::write_BNDorRED(t, output_red_file.c_str());
 }
 
-void Persistence_Computer::write_pers_V(const vector<vector<vector<int>>>& pers_V) {
+void Persistence_Computer::write_pers_V(const PairList& pers) {
 	string output_persV_file = output_name + ".pers";
-	BinaryPersistentPairsSaver<1>::write_pers_V(pers_V, output_persV_file.c_str());
+	BinaryPersistentPairsSaver<1>::write_pers_V(pers, output_persV_file.c_str());
 }
 
-void Persistence_Computer::write_pers_BD(const vector<vector<vector<double>>>& pers_BD) {
+void Persistence_Computer::write_pers_BD(const PairList& pers) {
 	string output_persBD_file = output_name + ".pers.txt";
-	BinaryPersistentPairsSaver<1>::write_pers_BD(pers_BD, output_persBD_file.c_str());
+	BinaryPersistentPairsSaver<1>::write_pers_BD(pers, output_persBD_file.c_str());
 }
 
-void Persistence_Computer::write_pers_BD(const vector<vector<double>>& pers_BD) {
-	string output_persBD_file = output_name + ".pers.txt";
-	BinaryPersistentPairsSaver<1>::write_pers_BD(pers_BD, output_persBD_file.c_str());
+void Persistence_Computer::return_bnd(CycleList& t) { t = result.boundaries; };
+void Persistence_Computer::return_red(CycleList& t) { t = result.reductions; };
+void Persistence_Computer::return_pers(PairList& t) { t = result.pairs; };
+void Persistence_Computer::return_pers_status(vector<int>& t) { t = result.status; };
+const PersistenceResult& Persistence_Computer::get_result() const { return result; }
+
+// The k most persistent pairs of the given dimension, most persistent first
+void Persistence_Computer::top_k_pairs(int dim, int k, vector<int>& pairs) {
+	const PairList& pers = result.pairs;
+	pairs.resize(pers.numPairs(dim));
+	for (int j = 0; j < pairs.size(); j++)
+		pairs[j] = pers.dimOffsets[dim] + j;
+
+	k = std::max(0, std::min(k, (int)pairs.size()));
+	std::partial_sort(pairs.begin(), pairs.begin() + k, pairs.end(), [&pers](int a, int b) {
+		double persA = pers.death(a) - pers.birth(a);
+		double persB = pers.death(b) - pers.birth(b);
+		return persA > persB || (persA == persB && a < b);
+	});
+	pairs.resize(k);
+}
+
+// The pairs of the given dimension whose persistence is bigger than thd
+void Persistence_Computer::pairs_above(int dim, double thd, vector<int>& pairs) {
+	const PairList& pers = result.pairs;
+	pairs.clear();
+	for (int p = pers.dimOffsets[dim]; p < pers.dimOffsets[dim + 1]; p++)
+		if (pers.death(p) - pers.birth(p) > thd)
+			pairs.push_back(p);
+}
+
+// The reduction and boundary lists of the given pairs, as one dimension in the order of pairs
+void Persistence_Computer::get_representatives(const vector<int>& pairs, CycleList& reductions, CycleList& boundaries) {
+	reductions = CycleList(result.pairs.coordDim);
+	boundaries = CycleList(result.pairs.coordDim);
+	reductions.addDimension();
+	boundaries.addDimension();
+	append_representatives(pairs, reductions, boundaries);
 }
 
-void Persistence_Computer::return_bnd(vector<vector<vector<vector<int>>>>& t) { t = final_boundary_list_grand; };
-void Persistence_Computer::return_red(vector<vector<vector<vector<int>>>>& t) { t = final_red_list_grand; };
-void Persistence_Computer::return_pers_V(vector<vector<vector<int>>>& t) { t = pers_V; };
-void Persistence_Computer::return_pers_BD(vector<vector<vector<double>>>& t) { t = pers_BD; };
+// Append the reduction and boundary lists of the given pairs to the last dimension of reductions and boundaries
+void Persistence_Computer::append_representatives(const vector<int>& pairs, CycleList& reductions, CycleList& boundaries) {
+	const PairList& pers = result.pairs;
+	const int coordDim = pers.coordDim;
+	vector<int> vertices;
+	for (int p : pairs) {
+		assert(p >= 0 && p < pers.numPairs());
+		if (!result.lazy) {
+			CycleList::CycleView red = result.reductions[p], bnd = result.boundaries[p];
+			reductions.coords.insert(reductions.coords.end(), red.begin(), red.end());
+			boundaries.coords.insert(boundaries.coords.end(), bnd.begin(), bnd.end());
+		}
+		else {
+			// the vertices of a chain are the union of the vertices of its cells
+			int dim = std::upper_bound(pers.dimOffsets.begin(), pers.dimOffsets.end(), p) - pers.dimOffsets.begin() - 1;
+			int j = p - pers.dimOffsets[dim];
+
+			vertices.clear();
+			list_union_k(result.reductionChains[dim].chains[j], result.reductionChains[dim].cells, vertices);
+			for (int v : vertices)
+				reductions.coords.insert(reductions.coords.end(), result.vertexCoords.begin() + v * coordDim, result.vertexCoords.begin() + (v + 1) * coordDim);
+
+			vertices.clear();
+			list_union_k(result.boundaryChains[dim].chains[j], result.boundaryChains[dim].cells, vertices);
+			for (int v : vertices)
+				boundaries.coords.insert(boundaries.coords.end(), result.vertexCoords.begin() + v * coordDim, result.vertexCoords.begin() + (v + 1) * coordDim);
+		}
+		reductions.addCycle();
+		boundaries.addCycle();
+	}
+}
 
 void Persistence_Computer::write_output() {
-	write_bnd(final_boundary_list_grand);
-	write_red(final_red_list_grand);
-	write_pers_V(pers_V);
-	write_pers_BD(pers_BD);
+	if (result.lazy) { // build the reduction and boundary lists of all pairs
+		const PairList& pers = result.pairs;
+		CycleList reductions(pers.coordDim), boundaries(pers.coordDim);
+		vector<int> pairs;
+		for (int dim = 0; dim < pers.numDims(); dim++) {
+			pairs.clear();
+			for (int p = pers.dimOffsets[dim]; p < pers.dimOffsets[dim + 1]; p++)
+				pairs.push_back(p);
+			reductions.addDimension();
+			boundaries.addDimension();
+			append_representatives(pairs, reductions, boundaries);
+		}
+		write_bnd(boundaries);
+		write_red(reductions);
+	}
+	else {
+		write_bnd(result.boundaries);
+		write_red(result.reductions);
+	}
+	write_pers_V(result.pairs);
+	write_pers_BD(result.pairs);
 }
 void Persistence_Computer::clear() {
-	final_red_list_grand.clear();
-	final_boundary_list_grand.clear();
-	pers_V.clear();
-	pers_BD.clear();
+	result.clear();
 }
 
 void Persistence_Computer::debugStart(const string& debug_path) {
@@ -169,10 +257,7 @@ int main(int argc, const char* argv[])
 
 	parseCommandLine(argc, argv);
 
-	vector<vector<vector<vector<int>>>> final_red_list_grand;
-	vector<vector<vector<vector<int>>>> final_boundary_list_grand;
-	vector<vector<vector<int>>> pers_V;
-	vector<vector<vector<double>>> pers_BD;
+	PersistenceResult result;
 
 	InputFileInfo input_file_info;
 	input_file_info.source_from_file(Globals::inputFileName);
@@ -181,7 +266,7 @@ int main(int argc, const char* argv[])
 	time(&startTime);
 
 	// Run persistence homology algorithm
-	runPersistenceHomology(input_file_info, final_red_list_grand, final_boundary_list_grand, pers_V, pers_BD);
+	runPersistenceHomology(input_file_info, result);
 
 	time(&endTime);
 
@@ -199,10 +284,8 @@ int main(int argc, const char* argv[])
 //	std::string file_name = "D:/Data/ChaoData_proc/sublvl/000B_sub.dat";
 //	//cv::Mat img = cv::imread(file_name, 0);
 //
-//	vector<vector<vector<vector<int>>>> final_red_list_grand;
-//	vector<vector<vector<vector<int>>>> final_boundary_list_grand;
-//	vector<vector<vector<int>>> pers_V;
-//	vector<vector<vector<double>>> pers_BD;
+//	CycleList final_boundary_list_grand;
+//	PairList pers;
 //
 //	Persistence_Computer pc;
 //	//pc.source_from_mat(file_name, img);
@@ -211,7 +294,7 @@ int main(int argc, const char* argv[])
 //	pc.write_output();
 //
 //	pc.return_bnd(final_boundary_list_grand);
-//	pc.return_pers_V(pers_V);
+//	pc.return_pers(pers);
 //
 //
 //	pc.clear();
@@ -7,6 +7,7 @@
 #include <opencv2/opencv.hpp>
 
 #include "InputFileInfo.h"
+#include "PersistenceResult.h"
 
 class Persistence_Computer {
 public:
@@ -27,18 +28,35 @@ public:
 	void set_algorithm(int t);
 	void set_max_dim(int t);
 	void set_num_threads(int t);
+	void set_pattern_database(int bits, int memory_mb = 1024);
+	void set_spanning_tree_seed(unsigned int seed);
+	void set_search_budget(long long max_nodes, int max_memory_mb = 0, double max_seconds = 0);
+	void set_search_window(int halo);
+	void set_rips_threshold(double t);
+	void set_minkowski_p(double t);
+	void set_rips_approximation(double epsilon);
+	void set_alpha_complex(bool t);
+	void set_edge_collapse(bool t);
+	void set_lazy_representatives(bool t);
 	void set_verbose(bool t);
 	void set_debug(bool t, const std::string& debug_path_=".");
 
-	void write_bnd(const std::vector<std::vector<std::vector<std::vector<int>>>>& t);
-	void write_red(const std::vector<std::vector<std::vector<std::vector<int>>>>& t);
-	void write_pers_V(const std::vector<std::vector<std::vector<int>>>& pers_V);
-	void write_pers_BD(const std::vector<std::vector<std::vector<double>>>& pers_BD);
-	void write_pers_BD(const std::vector<std::vector<double>>& pers_BD);
-	void return_bnd(std::vector<std::vector<std::vector<std::vector<int>>>>& t);
-	void return_red(std::vector<std::vector<std::vector<std::vector<int>>>>& t);
-	void return_pers_V(std::vector<std::vector<std::vector<int>>>& t);
-	void return_pers_BD(std::vector<std::vector<std::vector<double>>>& t);
+	void write_bnd(const CycleList& t);
+	void write_red(const CycleList& t);
+	void write_pers_V(const PairList& pers);
+	void write_pers_BD(const PairList& pers);
+	void return_bnd(CycleList& t);
+	void return_red(CycleList& t);
+	void return_pers(PairList& t);
+	void return_pers_status(std::vector<int>& t);
+	const PersistenceResult& get_result() const;
+
+	// Select pairs (as indices into the pair list) and build their reduction and boundary lists on demand.
+	// With set_lazy_representatives(true), run() only keeps them in compact form, so that runs which
+	// need only the diagrams, or a few representatives, do not pay for all of them.
+	void top_k_pairs(int dim, int k, std::vector<int>& pairs);
+	void pairs_above(int dim, double thd, std::vector<int>& pairs);
+	void get_representatives(const std::vector<int>& pairs, CycleList& reductions, CycleList& boundaries);
 
 	void write_output();
 	void clear();
@@ -46,16 +64,14 @@ public:
 	static void debugEnd();
 
 private:
+	void append_representatives(const std::vector<int>& pairs, CycleList& reductions, CycleList& boundaries);
 
 	bool debug_enabled;
 	std::string debug_path;
 	std::string output_name;
 	InputFileInfo file_info;
 
-	std::vector<std::vector<std::vector<std::vector<int>>>> final_red_list_grand;
-	std::vector<std::vector<std::vector<std::vector<int>>>> final_boundary_list_grand;
-	std::vector<std::vector<std::vector<int>>> pers_V;
-	std::vector<std::vector<std::vector<double>>> pers_BD;
+	PersistenceResult result;
 };
 
 #endif // !PERSISTENCE_COMPUTER
\ No newline at end of file
@@ -6,17 +6,13 @@
 using namespace std;
 
 %template(cpp_nested1_IntVector) vector<int>;
-%template(cpp_nested2_InvVector) vector<vector<int>>;
-%template(cpp_nested3_IntVector) vector<vector<vector<int>>>;
-%template(cpp_nested4_IntVector) vector<vector<vector<vector<int>>>>;
-
 %template(cpp_nested1_DoubleVector) vector<double>;
-%template(cpp_nested2_DoubleVector) vector<vector<double>>;
-%template(cpp_nested3_DoubleVector) vector<vector<vector<double>>>;
 
 %{
+#include "PersistenceResult.h"
 #include "PersistenceComputer.h"
 %}
 
 //double-check that this is indeed %include !!!
+%include "PersistenceResult.h"
 %include "PersistenceComputer.h"
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <malloc.h>
 #include <ctime>
 #include "Debugging.h"
+#include "PersistenceResult.h"
 
 #define SWAP(a, b)  do { a ^= b; b ^= a; a ^= b; } while ( 0 )
 
@@ -16,7 +17,7 @@ typedef vector<int> MatrixListType;
 /************************************************************************/
 /* Save persistence values and reduction results and reduction results to binary file			 */
 /************************************************************************/
-void saveResults(const char *fileName,unsigned int *data, const vector<int> &header, int nrPairs);
+void saveResults(const char *fileName, const unsigned int *data, const vector<int> &header, int nrPairs);
 
 
 template<int d>
@@ -46,6 +47,15 @@ struct TextPersistentPairsSaver
 };
 
 
+// The vertex written to the output files for a vertex of vList: the vertex itself, unless
+// the type of the vertex list overloads this (see RipsVertexList)
+template<typename VertexListT, typename VertexT>
+VertexT outputVertex(const VertexListT &, const VertexT & vertex)
+{
+	return vertex;
+}
+
+
 template<int d, int arrayDim = d, int vertexDim = d>
 struct BinaryPersistentPairsSaver
 {
@@ -181,194 +191,121 @@ struct BinaryPersistentPairsSaver
 		delete[] redArray;
 	}
 
-	// Added by Fan Wang
-	void index2coord(const vector<MatrixListType>& final_list, vector<Vertex>& vList, vector<vector<vector<int>>>& res) {
-		res.resize(final_list.size());
-		for (int i = 0; i < final_list.size(); i++) {
-			res[i].resize(final_list[i].size());
-			for (int j = 0; j < final_list[i].size(); j++) {
-				res[i][j].resize(d);
-				Vertex coord = vList[final_list[i][j]];
-				for (size_t k = 0; k < d; k++) {
+	// Coordinate k of a vertex as written to the output files (the fastest changing coordinate first)
+	template<int n>
+	static int outputCoord(const blitz::TinyVector<int, n> & coord, int k)
+	{
+		if (d - 1 - k >= n) // the vertices of complexes have fewer coordinates than the complex dimension
+			return 0;
 #ifdef MATLAB_USE
-					res[i][j][k] = coord[d - 1 - k] + 1;
+		return coord[d - 1 - k] + 1;
 #else
-					res[i][j][k] = coord[d - 1 - k];
+		return coord[d - 1 - k];
 #endif
-				}
+	}
+
+	// Append the cycles of vertexLists (vertex indices) to res as one dimension of vertex coordinates
+	template<typename VertexListT>
+	void index2coord(const CycleList & vertexLists, const VertexListT & vList, CycleList & res) {
+		assert(res.coordDim == d);
+		res.addDimension();
+		res.coords.reserve(res.coords.size() + vertexLists.coords.size() * d);
+		res.cycleOffsets.reserve(res.cycleOffsets.size() + vertexLists.numCycles());
+		for (int c = 0; c < vertexLists.numCycles(); c++) {
+			for (int v = vertexLists.cycleOffsets[c]; v < vertexLists.cycleOffsets[c + 1]; v++) {
+				auto coord = outputVertex(vList, vList[vertexLists.coords[v]]);
+				for (int k = 0; k < d; k++)
+					res.coords.push_back(outputCoord(coord, k));
 			}
+			res.addCycle();
 		}
 	}
 
-	// Added by Fan Wang
-	template<typename ContT>
-	void pers2vector(const vector<ContT>& pers, vector<vector<vector<int>>>& pers_V, vector<vector<vector<double>>>& pers_BD) {
-		assert(pers.size() == d);
-		vector<int> header(d);
-		pers_V.resize(d);
-		pers_BD.resize(d);
-
-		for (size_t i = 0; i < d; i++) {
-			header[i] = pers[i].size();
-			pers_V[i].resize(pers[i].size());
-			pers_BD[i].resize(pers[i].size());
-			for (int j = 0; j < pers[i].size(); j++) {
-				Vertex birthcoord = pers[i][j].birthV;
-				Vertex deathcoord = pers[i][j].deathV;
-
-				int index = 0;
-				vector<double> tmp_BD = { pers[i][j].birth, pers[i][j].death };
-				vector<int> tmp_V(2 * d);
-				for (size_t ii = 0; ii < d; ii++) {
-#ifdef MATLAB_USE
-					tmp_V[index++] = birthcoord[d - 1 - ii] + 1;
-#else
-					tmp_V[index++] = birthcoord[d - 1 - ii];
-#endif
-				}
-				for (size_t ii = 0; ii < d; ii++) {
-#ifdef MATLAB_USE
-					tmp_V[index++] = deathcoord[d - 1 - ii] + 1;
-#else
-					tmp_V[index++] = deathcoord[d - 1 - ii];
-#endif
-				}
-				assert(index == 2 * d);
-				pers_V[i][j] = tmp_V;
-				pers_BD[i][j] = tmp_BD;
-			}
+	// Renumber the vertices used by the compact chains in increasing order (so the cells stay sorted) and save their coordinates
+	template<typename VertexListT>
+	void compactVertices(const VertexListT & vList, const vector<char> & used, vector<ChainList> & reductionChains,
+		vector<ChainList> & boundaryChains, vector<int> & res) {
+		vector<int> newIndex(vList.size(), -1);
+		int count = 0;
+		for (int v = 0; v < vList.size(); v++) {
+			if (!used[v])
+				continue;
+			newIndex[v] = count++;
+			auto coord = outputVertex(vList, vList[v]);
+			for (int k = 0; k < d; k++)
+				res.push_back(outputCoord(coord, k));
 		}
+
+		for (auto & chainList : reductionChains)
+			for (auto & v : chainList.cells.coords)
+				v = newIndex[v];
+		for (auto & chainList : boundaryChains)
+			for (auto & v : chainList.cells.coords)
+				v = newIndex[v];
 	}
 
-	// Added by Fan Wang
-	template<typename ContT>
-	void pers2vector(const ContT& pers, vector<vector<int>>& pers_V, vector<vector<double>>& pers_BD) {
-		pers_V.resize(pers.size());
-		pers_BD.resize(pers.size());
+	// Append the persistence pairs (whose vertices come from vList) to res as one dimension
+	template<typename ContT, typename VertexListT>
+	void pers2vector(const ContT & pers, const VertexListT & vList, PairList & res) {
+		assert(res.coordDim == d);
+		res.addDimension();
+		res.coords.reserve(res.coords.size() + pers.size() * 2 * d);
+		res.values.reserve(res.values.size() + pers.size() * 2);
 		for (int i = 0; i < pers.size(); i++) {
-			Vertex birthcoord = pers[i].birthV;
-			Vertex deathcoord = pers[i].deathV;
-
-			int index = 0;
-			vector<double> tmp_BD = { pers[i].birth, pers[i].death };
-			vector<int> tmp_V(2 * d);
-			for (size_t j = 0; j < d; j++) {
-#ifdef MATLAB_USE
-				tmp_V[index++] = birthcoord[d - 1 - j] + 1;
-#else
-				tmp_V[index++] = birthcoord[d - 1 - j];
-#endif
-			}
-			for (size_t j = 0; j < d; j++) {
-#ifdef MATLAB_USE
-				tmp_V[index++] = deathcoord[d - 1 - j] + 1;
-#else
-				tmp_V[index++] = deathcoord[d - 1 - j];
-#endif
-			}
-			assert(index == 2 * d);
-			pers_V[i]  = tmp_V;
-			pers_BD[i] = tmp_BD;
+			auto birthCoord = outputVertex(vList, pers[i].birthV);
+			auto deathCoord = outputVertex(vList, pers[i].deathV);
+			for (int k = 0; k < d; k++)
+				res.coords.push_back(outputCoord(birthCoord, k));
+			for (int k = 0; k < d; k++)
+				res.coords.push_back(outputCoord(deathCoord, k));
+			res.addPair(pers[i].birth, pers[i].death);
 		}
 	}
 
-	// Added by Fan Wang
-	static void write_BNDorRED(const vector<vector<vector<vector<int>>>>& t, const char *output_name) {
+	// Write the cycles to a binary file: for every cycle a record (size, 0, ..., 0) followed by its vertices
+	static void write_BNDorRED(const CycleList & t, const char *output_name) {
 
-		const int dim = t.size();
+		const int dim = t.coordDim;
 
-		// Determine the size of the data buffer
-		int count = 0;
-		vector<int> header(dim);
-		for (size_t i = 0; i < dim; i++) {
-			header[i] = t[i].size();
-			count += t[i].size();
-			for (int j = 0; j < t[i].size(); j++) {
-				assert(t[i][j].size() != 0);
-				count += t[i][j].size();
-			}
-		}
-		unsigned int *data = new unsigned int[count * dim];
+		vector<int> header(t.numDims());
+		for (int i = 0; i < t.numDims(); i++)
+			header[i] = t.numCycles(i);
+
+		vector<unsigned int> data((t.numCycles() + t.cycleOffsets.back()) * dim, 0);
 		int index = 0;
-		for (size_t i = 0; i < dim; i++) {
-			for (int j = 0; j < t[i].size(); j++) {
-				data[index++] = t[i][j].size();
-				for (int dum = 1; dum < dim; dum++) {
-					data[index++] = 0;
-				}
+		for (int c = 0; c < t.numCycles(); c++) {
+			data[index] = t.cycleSize(c);
+			index += dim;
 
-				for (int k = 0; k < t[i][j].size(); k++) {
-					for (size_t l = 0; l < dim; l++) {
-						data[index++] = t[i][j][k][l];
-					}
-				}
-			}
+			std::copy(t.coords.begin() + t.cycleOffsets[c] * dim, t.coords.begin() + t.cycleOffsets[c + 1] * dim, data.begin() + index);
+			index += t.cycleSize(c) * dim;
 		}
-		assert(index == count * dim);
-		saveResults(output_name, data, header, index);
-
-		delete data;
+		assert(index == data.size());
+		saveResults(output_name, data.data(), header, index);
 	}
 
-	// Added by Fan Wang
-	static void write_pers_V(
-		const vector<vector<vector<int>>>& pers_V,
-		const char* output_fname_V
-	) {
+	// Write the coordinates of the birth and death vertices of the pairs to a binary file
+	static void write_pers_V(const PairList & pers, const char* output_fname_V) {
 		// ===== write out dat file =====
-		const int dim = pers_V.size();
-		int count = 0;
-		vector<int> header(dim);
-		for (size_t i = 0; i < dim; i++) {
-			count += pers_V[i].size();
-			header[i] = pers_V[i].size();
-		}
-
-		int index = 0;
-		unsigned int *data = new unsigned int[count * 2 * dim];
-		for (size_t i = 0; i < dim; i++) {
-			for (int j = 0; j < pers_V[i].size(); j++) {
-				for (size_t ii = 0; ii < dim * 2; ii++) {
-					data[index++] = pers_V[i][j][ii];
-				}
-			}
-		}
-		assert(index == count * 2 * dim);
-		saveResults(output_fname_V, data, header, index);
-		delete data;
-	}
+		vector<int> header(pers.numDims());
+		for (int i = 0; i < pers.numDims(); i++)
+			header[i] = pers.numPairs(i);
 
-	// Added by Fan Wang
-	static void write_pers_BD(
-		const vector<vector<vector<double>>>& pers_BD,
-		const char* output_fname_BD
-	) {
-		// ===== Write out txt file =====
-		const int dim = pers_BD.size();
-		string names[] = { "Vertex", "Edge", "Face", "Cube", "4D-Cell", "5D-Cell" };
-		fstream output_filestr(output_fname_BD, fstream::out | fstream::trunc);
-		for (size_t i = 0; i < dim; i++) {
-			output_filestr << names[i] << " " << names[i + 1] << " Pairs, Number = " << pers_BD[i].size() << endl;
-			for (int j = 0; j < pers_BD[i].size(); j++) {
-				output_filestr << pers_BD[i][j][0] << "\t" << pers_BD[i][j][1] << endl;
-			}
-		}
-		output_filestr.close();
+		saveResults(output_fname_V, reinterpret_cast<const unsigned int *>(pers.coords.data()), header, pers.coords.size());
 	}
 
-	// Added by Fan Wang
-	static void write_pers_BD(
-		const vector<vector<double>>& pers_BD,
-		const char* output_fname_BD
-	) {
+	// Write the birth and death values of the pairs to a text file
+	static void write_pers_BD(const PairList & pers, const char* output_fname_BD) {
 		// ===== Write out txt file =====
-		const int dim = pers_BD.size();
+		const int dim = pers.numDims();
 		string names[] = { "Vertex", "Edge", "Face", "Cube", "4D-Cell", "5D-Cell" };
 		fstream output_filestr(output_fname_BD, fstream::out | fstream::trunc);
-		for (size_t i = 0; i < dim; i++) {
-			output_filestr << names[i] << " " << names[i + 1] << " Pairs, Number = " << pers_BD[i].size() / 2 << endl;
-			for (int j = 0; j < pers_BD[i].size() / 2; j++) {
-				output_filestr << pers_BD[i][j * 2] << "\t" << pers_BD[i][j * 2 + 1] << endl;
+		if (pers.approximationFactor != 1.)
+			output_filestr << "Approximation factor = " << pers.approximationFactor << endl;
+		for (int i = 0; i < dim; i++) {
+			output_filestr << names[i] << " " << names[i + 1] << " Pairs, Number = " << pers.numPairs(i) << endl;
+			for (int p = pers.dimOffsets[i]; p < pers.dimOffsets[i + 1]; p++) {
+				output_filestr << pers.birth(p) << "\t" << pers.death(p) << endl;
 			}
 		}
 		output_filestr.close();
@@ -377,7 +314,7 @@ struct BinaryPersistentPairsSaver
 
 
 // Save persistence values and reduction results to binary file
-void saveResults(const char *fileName, unsigned int *data, const vector<int> &header, int count)
+void saveResults(const char *fileName, const unsigned int *data, const vector<int> &header, int count)
 {
 	FILE *outFile;
 
@@ -388,7 +325,7 @@ void saveResults(const char *fileName, unsigned int *data, const vector<int> &he
 
 	fwrite((void*)&header[0], sizeof(unsigned int), dim, outFile);
 
-	int writeCount = fwrite((void *)data, sizeof(unsigned int), count, outFile);
+	int writeCount = fwrite((const void *)data, sizeof(unsigned int), count, outFile);
 
 	//printf("Writing %d Data Reduction Results in File %s\n", writeCount, fileName);
 
@@ -0,0 +1,165 @@
+#ifndef PERSISTENCE_RESULT_H
+#define PERSISTENCE_RESULT_H
+
+#include <vector>
+
+
+/********************************************************************
+* The cycles (reduction or boundary lists) of all dimensions, stored as flat arrays.
+* Cycle c consists of the vertices cycleOffsets[c] .. cycleOffsets[c + 1] - 1, and the
+* cycles of dimension i are dimOffsets[i] .. dimOffsets[i + 1] - 1. Vertex v has the
+* coordinates coords[v * coordDim] .. coords[(v + 1) * coordDim - 1].
+* With coordDim 1, the list can also hold vertex indices instead of coordinates.
+* The list is built one dimension at a time: addDimension(), then for every cycle its
+* coordinates are appended to coords and addCycle() closes it.
+********************************************************************/
+struct CycleList
+{
+	int coordDim;					// the number of coordinates of a vertex
+	std::vector<int> coords;		// the coordinates of the vertices of all cycles
+	std::vector<int> cycleOffsets;	// the first vertex of each cycle, plus the end
+	std::vector<int> dimOffsets;	// the first cycle of each dimension, plus the end
+
+	CycleList(int coordDim_ = 0) : coordDim(coordDim_), cycleOffsets(1, 0), dimOffsets(1, 0) {}
+
+	int numDims() const { return dimOffsets.size() - 1; }
+	int numCycles() const { return cycleOffsets.size() - 1; }
+	int numCycles(int dim) const { return dimOffsets[dim + 1] - dimOffsets[dim]; }
+	int cycleSize(int cycle) const { return cycleOffsets[cycle + 1] - cycleOffsets[cycle]; }
+
+	// coordinate k of vertex v of the given cycle
+	int coord(int cycle, int v, int k) const { return coords[(cycleOffsets[cycle] + v) * coordDim + k]; }
+
+#ifndef SWIG
+	// read-only view of the coordinates of one cycle, usable like a list (e.g., by list_union_k)
+	struct CycleView
+	{
+		typedef int value_type;
+		const int * first;
+		int count;
+		int size() const { return count; }
+		bool empty() const { return count == 0; }
+		int operator[](int i) const { return first[i]; }
+		const int * begin() const { return first; }
+		const int * end() const { return first + count; }
+	};
+	CycleView operator[](int cycle) const { return CycleView{ coords.data() + cycleOffsets[cycle] * coordDim, cycleSize(cycle) * coordDim }; }
+#endif
+
+	void addDimension() { dimOffsets.push_back(dimOffsets.back()); }
+	void addCycle()
+	{
+		cycleOffsets.push_back(coords.size() / coordDim);
+		++dimOffsets.back();
+	}
+
+	// append all cycles of other (with the same coordDim) to the last dimension
+	void append(const CycleList & other)
+	{
+		coords.insert(coords.end(), other.coords.begin(), other.coords.end());
+		cycleOffsets.reserve(cycleOffsets.size() + other.numCycles());
+		for (int c = 1; c <= other.numCycles(); c++)
+			cycleOffsets.push_back(cycleOffsets.back() + other.cycleOffsets[c] - other.cycleOffsets[c - 1]);
+		dimOffsets.back() += other.numCycles();
+	}
+
+	void clear()
+	{
+		coords.clear();
+		cycleOffsets.assign(1, 0);
+		dimOffsets.assign(1, 0);
+	}
+};
+
+
+/********************************************************************
+* The persistence pairs of all dimensions, stored as flat arrays.
+* The pairs of dimension i are dimOffsets[i] .. dimOffsets[i + 1] - 1. Pair p is born at
+* values[2p] and dies at values[2p + 1]; its birth and death vertices have the coordinates
+* coords[2p * coordDim] .. coords[(2p + 1) * coordDim - 1] and
+* coords[(2p + 1) * coordDim] .. coords[(2p + 2) * coordDim - 1].
+* If the filtration is approximate, the exact diagram is within approximationFactor of these
+* pairs: the log-scale bottleneck distance is at most log(approximationFactor).
+********************************************************************/
+struct PairList
+{
+	int coordDim;					// the number of coordinates of a vertex
+	std::vector<int> coords;		// the coordinates of the birth and death vertices
+	std::vector<double> values;		// the birth and death values
+	std::vector<int> dimOffsets;	// the first pair of each dimension, plus the end
+	double approximationFactor;		// 1 for an exact diagram
+
+	PairList(int coordDim_ = 0) : coordDim(coordDim_), dimOffsets(1, 0), approximationFactor(1.) {}
+
+	int numDims() const { return dimOffsets.size() - 1; }
+	int numPairs() const { return values.size() / 2; }
+	int numPairs(int dim) const { return dimOffsets[dim + 1] - dimOffsets[dim]; }
+	double birth(int pair) const { return values[2 * pair]; }
+	double death(int pair) const { return values[2 * pair + 1]; }
+
+	void addDimension() { dimOffsets.push_back(dimOffsets.back()); }
+	void addPair(double birth, double death)
+	{
+		values.push_back(birth);
+		values.push_back(death);
+		++dimOffsets.back();
+	}
+
+	void clear()
+	{
+		coords.clear();
+		values.clear();
+		dimOffsets.assign(1, 0);
+		approximationFactor = 1.;
+	}
+};
+
+
+/********************************************************************
+* The reduction or boundary lists of the pairs of one dimension in compact form, i.e.,
+* as columns of the reduced matrix: chain j lists its cells, and cell c lists its
+* vertices (sorted, as indices into PersistenceResult::vertexCoords). Only the cells
+* used by the chains are kept.
+********************************************************************/
+struct ChainList
+{
+	CycleList chains;	// the cells of each chain
+	CycleList cells;	// the vertices of each cell
+
+	ChainList() : chains(1), cells(1)
+	{
+		chains.addDimension();
+		cells.addDimension();
+	}
+};
+
+
+// The result of a persistence computation
+struct PersistenceResult
+{
+	CycleList reductions;		// the reduction lists, written to .red
+	CycleList boundaries;		// the boundary lists, written to .bnd
+	PairList pairs;				// the persistence pairs, written to .pers and .pers.txt
+	std::vector<int> status;	// the Globals::CycleStatus of each boundary list
+
+	// with Globals::lazy_representatives, the reduction and boundary lists are not built;
+	// the compact chains below are kept instead, so that only the requested ones are built
+	bool lazy = false;
+	std::vector<ChainList> reductionChains;		// per dimension
+	std::vector<ChainList> boundaryChains;		// per dimension
+	std::vector<int> vertexCoords;				// the coordinates of the vertices used by the chains, pairs.coordDim per vertex
+
+	void clear()
+	{
+		reductions.clear();
+		boundaries.clear();
+		pairs.clear();
+		status.clear();
+		lazy = false;
+		reductionChains.clear();
+		boundaryChains.clear();
+		vertexCoords.clear();
+	}
+};
+
+#endif // !PERSISTENCE_RESULT_H
@@ -1,162 +1,162 @@
 #ifndef _PRIORITY_QUEUE_H_
 #define _PRIORITY_QUEUE_H_
 #include <iostream>
-#include <map>
 #include <vector>
 #include "Globals.h"
 #include "BitSet.h"
 using namespace std;
 
 
+/********************************************************************
+* Indexed d-ary min-heap used as the open set of A* search.
+* The heap only stores 32-bit handles into a node pool owned by the caller, so
+* push, pop and decrease-key never copy node payloads (annotations, scores).
+* mHeapPos maps a handle to its slot in the heap, or -1 if it is not queued.
+********************************************************************/
 class priorityQueue
 {
 public:
-	priorityQueue();
+	priorityQueue(const vector<cgNode> &);
 	~priorityQueue();
-	void push(const cgNode &);
-	cgNode top();
+	void push(int);
+	int top() const;
 	void pop();
 	void clear();
-	bool isEmpty();
-	bool updateNodeInQueue(const cgNode &);
+	bool isEmpty() const;
+	int size() const;
+	bool contains(int) const;
+	void decreaseKey(int);
 
 private:
-	vector<cgNode> dataArray;
-	int mSize;
-	void heapAdjustPop(int, int);
+	static const int ARITY = 4;		// 4-ary heap: shallower than binary, and children share a cache line
+	const vector<cgNode> & mNodes;	// the node pool which handles refer to
+	vector<int> mHeap;				// heap of node handles
+	vector<int> mHeapPos;			// handle -> slot in mHeap (-1 if not in the queue)
+	void heapAdjustPop(int);
 	void heapAdjustPush(int);
-	map<std::pair<int, BitSet>, int> mMap;
 };
 
 
-priorityQueue::priorityQueue()
+priorityQueue::priorityQueue(const vector<cgNode> & nodePool) : mNodes(nodePool)
 {
-	mSize = 0; // the 0th element will not be used
-	dataArray.push_back(cgNode()); // push a place holder
 }
 
 priorityQueue::~priorityQueue()
 {
-	dataArray.clear();
-	mMap.clear();
+	mHeap.clear();
+	mHeapPos.clear();
 }
 
-void priorityQueue::push(const cgNode & newItem)
+void priorityQueue::push(int handle)
 {
-	if (mSize == (dataArray.capacity() - 1)) // no enough memory
-	{
-		dataArray.resize(dataArray.capacity() * 2);
-	}
-	++mSize;
-	dataArray[mSize] = newItem;
-	mMap[std::make_pair(newItem.vertex, newItem.sumAnnotation)] = mSize;
+	if (handle >= (int)mHeapPos.size())
+		mHeapPos.resize(handle + 1, -1);
 
-	heapAdjustPush(mSize);
+	mHeap.push_back(handle);
+	mHeapPos[handle] = mHeap.size() - 1;
+
+	heapAdjustPush(mHeap.size() - 1);
 }
 
-cgNode priorityQueue::top()
+int priorityQueue::top() const
 {
-	return dataArray[1];
+	return mHeap.front();
 }
 
 void priorityQueue::pop()
 {
-	if (mSize == 0)
+	if (mHeap.empty())
 	{
 		cout << "Cannot pop any more!" << endl;
 		system("pause");
 		exit(1);
 	}
-	cgNode tempFront = dataArray[1];
-	dataArray[1] = dataArray[mSize--];
-	heapAdjustPop(1, mSize);
-	mMap.erase(std::make_pair(tempFront.vertex, tempFront.sumAnnotation));
+	mHeapPos[mHeap.front()] = -1;
+
+	int last = mHeap.back();
+	mHeap.pop_back();
+	if (!mHeap.empty())
+	{
+		mHeap[0] = last;
+		mHeapPos[last] = 0;
+		heapAdjustPop(0);
+	}
 }
 
 void priorityQueue::clear()
 {
-	mSize = 0; // release the memory
-	dataArray.clear();
-	mMap.clear();
-
-	dataArray.push_back(cgNode()); // push a place holder
+	mHeap.clear();
+	mHeapPos.clear();
 }
 
-void priorityQueue::heapAdjustPop(int start, int end) // the start element is to be sifted
+void priorityQueue::heapAdjustPop(int start) // the start element is to be sifted down
 {
+	int handle = mHeap[start];
 	int s = start;
-	cgNode rc = dataArray[start];
-	for (int j = 2 * s; j <= end; j *= 2)
+	int size = mHeap.size();
+	while (true)
 	{
-		if (j < end && (dataArray[j] < dataArray[j + 1]))
-			++j;
-		if (!(rc < dataArray[j]))
+		int first = s * ARITY + 1;
+		if (first >= size)
 			break;
 
-		dataArray[s] = dataArray[j];
-		mMap[std::make_pair(dataArray[j].vertex, dataArray[j].sumAnnotation)] = s;
-		s = j;
+		int best = first; // the child with the highest priority
+		int last = std::min(first + ARITY, size);
+		for (int j = first + 1; j < last; ++j)
+		{
+			if (mNodes[mHeap[best]] < mNodes[mHeap[j]])
+				best = j;
+		}
+
+		if (!(mNodes[handle] < mNodes[mHeap[best]]))
+			break;
+
+		mHeap[s] = mHeap[best];
+		mHeapPos[mHeap[s]] = s;
+		s = best;
 	}
-	dataArray[s] = rc;
-	mMap[std::make_pair(rc.vertex, rc.sumAnnotation)] = s;
+	mHeap[s] = handle;
+	mHeapPos[handle] = s;
 }
 
-void priorityQueue::heapAdjustPush(int end)
+void priorityQueue::heapAdjustPush(int end) // the end element is to be sifted up
 {
-	int parent = end / 2;
+	int handle = mHeap[end];
 	int curr = end;
-	cgNode temp_curr, temp_parent;
-	while (parent != 0)
+	while (curr > 0)
 	{
-		if (dataArray[parent] < dataArray[curr])
-		{
-			temp_parent = dataArray[parent];
-			temp_curr = dataArray[curr];
-			dataArray[parent] = temp_curr;
-			dataArray[curr] = temp_parent;
-
-			mMap[std::make_pair(temp_curr.vertex, temp_curr.sumAnnotation)] = parent;
-			mMap[std::make_pair(temp_parent.vertex, temp_parent.sumAnnotation)] = curr;
-
-			curr = parent;
-			parent = parent / 2;
-		}
-		else
-		{
+		int parent = (curr - 1) / ARITY;
+		if (!(mNodes[mHeap[parent]] < mNodes[handle]))
 			break;
-		}
+
+		mHeap[curr] = mHeap[parent];
+		mHeapPos[mHeap[curr]] = curr;
+		curr = parent;
 	}
+	mHeap[curr] = handle;
+	mHeapPos[handle] = curr;
 }
 
-bool priorityQueue::isEmpty()
+bool priorityQueue::isEmpty() const
 {
-	return mSize == 0;
+	return mHeap.empty();
 }
 
-bool priorityQueue::updateNodeInQueue(const cgNode & newNode)
+int priorityQueue::size() const
 {
-	map<pair<int, BitSet>, int>::iterator it;
+	return mHeap.size();
+}
 
-	it = mMap.find(std::make_pair(newNode.vertex, newNode.sumAnnotation));
-	if (it == mMap.end())
-	{
-		return false;
-	}
-	else
-	{
-		double currGScore = dataArray[it->second].gScore;
-		if (currGScore > newNode.gScore)
-		{
-			double hVal = dataArray[it->second].fScore - dataArray[it->second].gScore;
-			dataArray[it->second].gScore = newNode.gScore;
-			dataArray[it->second].fScore = hVal + newNode.gScore;
-			dataArray[it->second].previous = newNode.previous;
+bool priorityQueue::contains(int handle) const
+{
+	return handle < (int)mHeapPos.size() && mHeapPos[handle] != -1;
+}
 
-			// remake the heap
-			heapAdjustPush(it->second);
-		}
-		return true;
-	}
+// The caller has lowered the scores of the given node in the pool; restore the heap order
+void priorityQueue::decreaseKey(int handle)
+{
+	assert(contains(handle));
+	heapAdjustPush(mHeapPos[handle]);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -90,4 +90,44 @@ ListT list_union(const ListT &sa, const ListT &sb){
 
 	return out;
 }
+
+// Append the union of the lists lists[i], i in indices, to out in increasing order.
+// The lists are sorted increasingly and merged all at once with a heap (k-way merge), which takes
+// O(n log k) for n elements in k lists. Folding list_union over the lists instead would copy the
+// growing union for every list.
+template<typename IndexListT, typename ListsT, typename OutT>
+void list_union_k(const IndexListT &indices, const ListsT &lists, OutT &out){
+	typedef typename OutT::value_type ElemT;
+	struct Cursor
+	{
+		ElemT value;	// the current element of the list
+		int list;		// which list
+		int pos;		// the position of value in the list
+		bool operator>(const Cursor &rhs) const { return value > rhs.value; }
+	};
+
+	vector<Cursor> heap;
+	heap.reserve(indices.size());
+	for (auto idx : indices)
+		if (!lists[idx].empty())
+			heap.push_back({ lists[idx][0], (int)idx, 0 });
+	make_heap(heap.begin(), heap.end(), greater<Cursor>());
+
+	size_t outBegin = out.size();
+	while (!heap.empty())
+	{
+		pop_heap(heap.begin(), heap.end(), greater<Cursor>());
+		Cursor &curr = heap.back();
+		if (out.size() == outBegin || out.back() != curr.value)
+			out.push_back(curr.value);
+
+		if (++curr.pos < (int)lists[curr.list].size())
+		{
+			curr.value = lists[curr.list][curr.pos];
+			push_heap(heap.begin(), heap.end(), greater<Cursor>());
+		}
+		else
+			heap.pop_back();
+	}
+}
 #endif
@@ -0,0 +1,247 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include "Globals.h"
+
+
+/********************************************************************
+* A persistent pool of worker threads with work stealing.
+* run() executes tasks 0..n-1 and returns once all of them are done. Task i is first
+* queued at worker i % n, so if the tasks are given in decreasing order of cost, the
+* expensive ones are started first. A worker takes tasks from the front of its own
+* queue; once it is empty, it steals from the back of the other queues.
+* The task function receives (task index, worker index); the worker index can be used
+* to address per-worker scratch data. If run() is called from inside a task, the tasks
+* are executed serially by the calling worker, so nested parallel stages do not
+* oversubscribe the machine. If several outside threads call run(), their runs are
+* executed one after the other.
+********************************************************************/
+class threadPool
+{
+public:
+	threadPool(int numThreads);
+	~threadPool();
+	void run(int numTasks, const std::function<void(int, int)> & task);
+	int size() const;
+	static int currentWorker();
+
+private:
+	void workerLoop(int workerIdx);
+	bool fetchTask(int workerIdx, int & task);
+
+	std::vector<std::thread> mThreads;
+	std::vector<std::deque<int>> mQueues;				// task queue of each worker
+	std::unique_ptr<std::mutex[]> mQueueMutex;			// one lock per queue, only contended when stealing
+	std::mutex mRunMutex;								// held by the outside caller of the current run
+	std::mutex mMutex;
+	std::condition_variable mWakeUp;
+	std::condition_variable mFinished;
+	const std::function<void(int, int)> * mTask;		// the task function of the current run
+	int mBusy;											// number of workers still working on the current run
+	unsigned mGeneration;								// incremented for every run
+	bool mStop;
+
+	static thread_local int tWorkerIdx;					// worker index of the calling thread, -1 if not a worker
+};
+
+thread_local int threadPool::tWorkerIdx = -1;
+
+
+threadPool::threadPool(int numThreads) : mTask(nullptr), mBusy(0), mGeneration(0), mStop(false)
+{
+	numThreads = std::max(1, numThreads);
+	mQueues.resize(numThreads);
+	mQueueMutex.reset(new std::mutex[numThreads]);
+	for (int i = 0; i < numThreads; i++)
+		mThreads.push_back(std::thread(&threadPool::workerLoop, this, i));
+}
+
+threadPool::~threadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+	}
+	mWakeUp.notify_all();
+	std::for_each(mThreads.begin(), mThreads.end(), std::mem_fn(&std::thread::join));
+}
+
+int threadPool::size() const
+{
+	return mThreads.size();
+}
+
+int threadPool::currentWorker()
+{
+	return tWorkerIdx;
+}
+
+void threadPool::run(int numTasks, const std::function<void(int, int)> & task)
+{
+	if (numTasks <= 0)
+		return;
+
+	// nested call, or nothing to share: run on the calling thread
+	if (tWorkerIdx != -1 || numTasks == 1)
+	{
+		for (int i = 0; i < numTasks; i++)
+			task(i, std::max(tWorkerIdx, 0));
+		return;
+	}
+
+	std::lock_guard<std::mutex> runLock(mRunMutex);
+	int numWorkers = mThreads.size();
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (int w = 0; w < numWorkers; w++)
+		{
+			std::lock_guard<std::mutex> queueLock(mQueueMutex[w]);
+			mQueues[w].clear();
+			for (int i = w; i < numTasks; i += numWorkers)
+				mQueues[w].push_back(i);
+		}
+		mTask = &task;
+		mBusy = numWorkers;
+		++mGeneration;
+	}
+	mWakeUp.notify_all();
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	mFinished.wait(lock, [this] { return mBusy == 0; });
+	mTask = nullptr;
+}
+
+bool threadPool::fetchTask(int workerIdx, int & task)
+{
+	{
+		std::lock_guard<std::mutex> lock(mQueueMutex[workerIdx]);
+		if (!mQueues[workerIdx].empty())
+		{
+			task = mQueues[workerIdx].front();
+			mQueues[workerIdx].pop_front();
+			return true;
+		}
+	}
+
+	// our own queue is empty, try to steal from the others
+	int numWorkers = mQueues.size();
+	for (int k = 1; k < numWorkers; k++)
+	{
+		int victim = (workerIdx + k) % numWorkers;
+		std::lock_guard<std::mutex> lock(mQueueMutex[victim]);
+		if (!mQueues[victim].empty())
+		{
+			task = mQueues[victim].back();
+			mQueues[victim].pop_back();
+			return true;
+		}
+	}
+	return false;
+}
+
+void threadPool::workerLoop(int workerIdx)
+{
+	tWorkerIdx = workerIdx;
+	unsigned seenGeneration = 0;
+	const std::function<void(int, int)> * currTask;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWakeUp.wait(lock, [&] { return mStop || mGeneration != seenGeneration; });
+			if (mStop)
+				return;
+			seenGeneration = mGeneration;
+			currTask = mTask;
+		}
+
+		int task;
+		while (fetchTask(workerIdx, task))
+			(*currTask)(task, workerIdx);
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (--mBusy == 0)
+				mFinished.notify_all();
+		}
+	}
+}
+
+
+// The shared pool, with Globals::num_threads workers. It is created on first use, and created
+// again once Globals::num_threads has changed, so the number of threads may only be changed
+// while no other thread uses the pool (e.g., between two computations).
+threadPool & getThreadPool()
+{
+	static std::mutex poolMutex;
+	static std::unique_ptr<threadPool> pool;
+	std::lock_guard<std::mutex> lock(poolMutex);
+	if (!pool || pool->size() != std::max(1, Globals::num_threads))
+		pool.reset(new threadPool(Globals::num_threads));
+	return *pool;
+}
+
+
+// call f(begin, end, worker) on the blocks of grain consecutive items of 0..n-1, in parallel;
+// the blocks keep the number of tasks small when the work per item is tiny
+template<typename Function>
+void parallelForBlocks(int n, int grain, const Function & f)
+{
+	int numBlocks = (n + grain - 1) / grain;
+	getThreadPool().run(numBlocks, [&](int block, int worker) {
+		f(block * grain, std::min(n, (block + 1) * grain), worker);
+	});
+}
+
+// sort [first, last): one run per worker is sorted in parallel, then the runs are merged
+// pairwise, the merges of each round in parallel
+template<typename RandomIt, typename Compare>
+void parallelSort(RandomIt first, RandomIt last, Compare comp)
+{
+	const std::ptrdiff_t n = last - first;
+	const int numRuns = getThreadPool().size();
+	if (numRuns == 1 || n < 16384 || threadPool::currentWorker() != -1)
+	{
+		std::sort(first, last, comp);
+		return;
+	}
+
+	std::vector<std::ptrdiff_t> bounds(numRuns + 1); // run k is [bounds[k], bounds[k + 1])
+	for (int k = 0; k <= numRuns; k++)
+		bounds[k] = n * k / numRuns;
+	getThreadPool().run(numRuns, [&](int k, int) {
+		std::sort(first + bounds[k], first + bounds[k + 1], comp);
+	});
+
+	while (bounds.size() > 2)
+	{
+		getThreadPool().run((bounds.size() - 1) / 2, [&](int k, int) {
+			std::inplace_merge(first + bounds[2 * k], first + bounds[2 * k + 1], first + bounds[2 * k + 2], comp);
+		});
+
+		std::vector<std::ptrdiff_t> merged;
+		for (size_t k = 0; k < bounds.size(); k += 2)
+			merged.push_back(bounds[k]);
+		if (merged.back() != n)
+			merged.push_back(n);
+		bounds.swap(merged);
+	}
+}
+
+template<typename RandomIt>
+void parallelSort(RandomIt first, RandomIt last)
+{
+	parallelSort(first, last, std::less<typename std::iterator_traits<RandomIt>::value_type>());
+}
+
+#endif // !THREAD_POOL_H